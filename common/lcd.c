@@ -3,27 +3,33 @@
  * File Name          : lcd.c
  * Description        : This file provides code for the configuration
  *                      of HD44780 based LCD
- * @date    13-Feb-2021
+ * @date    16-Oct-2026
  * @author  Domen Jurkovic, Damogran Labs
  * @source  http://damogranlabs.com/
  *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
- * @version v1.4
+ * @version v2.0
  
  1. Set up library:
- 1.1. Set up GPIO defines in lcd_user.h
+ 1.1. Set up options in lcd_user.h
  1.2. Initialize all pins as output pins.
- 1.2. Create microcontroller-specific implementation of functions in lcd_user.c
+ 1.3. Create microcontroller-specific implementation of functions in lcd_user.c
+ 1.4. Describe LCD connection: bus (data, RS and R/W pins) and E pin
+ lcd_bus_t lcd_bus = {
+   .d = {[4] = {GPIOB, GPIO_PIN_4}, {GPIOB, GPIO_PIN_5}, {GPIOB, GPIO_PIN_6}, {GPIOB, GPIO_PIN_7}},
+   .rs = {GPIOA, GPIO_PIN_8},
+   .rw = {GPIOA, GPIO_PIN_9}};
+ lcd_t lcd = {.bus = &lcd_bus, .e = {GPIOA, GPIO_PIN_10}};
 
  2. Init library:
- lcd_init(2, 20); // 2 rows, 20 characters
+ lcd_init(&lcd, 2, 20); // 2 rows, 20 characters
 
  Examples:
  3. Print characters/strings/numbers:
  Note: x and y location starts with 0!
- lcd_print_str(0, 0, "www.damogranlabs.com ");
- lcd_print_str_windows(0, 0, 10, 350, "Find us on github and www.damogranlabs.com ");
- lcd_prin_num(1, 0, -10);
- lcd_prin_float(1, 0, -326.5635, 5);
+ lcd_print_str(&lcd, 0, 0, "www.damogranlabs.com ");
+ lcd_print_str_window(&lcd, 0, 0, 10, 350, "Find us on github and www.damogranlabs.com ");
+ lcd_print_int(&lcd, 1, 0, -10);
+ lcd_print_float(&lcd, 1, 0, -326.5635, 5);
 
  3.1. Create & print custom characters
  uint8_t damogranlabs_logo[]={
@@ -35,38 +41,142 @@
  0x00,
  0x00
  };
- lcd_create_char(0, damogranlabs_logo);
- lcd_put_char(0, 9, 0);
+ lcd_create_char(&lcd, 0, damogranlabs_logo);
+ lcd_put_char(&lcd, 0, 9, 0);
+
+ 4. Framebuffer mode (LCD_USE_FRAMEBUFFER defined in lcd_user.h):
+ Print functions only update framebuffer in RAM, call lcd_refresh() (for example, periodically in main loop)
+ to send only changed characters to LCD:
+ lcd_print_str(&lcd, 0, 0, "Temp:");
+ lcd_print_int_width(&lcd, 0, 6, temperature, 4, false);
+ lcd_refresh(&lcd);
+
+ 5. Asynchronous mode (LCD_ASYNC defined in lcd_user.h, user implements lcd_get_us()):
+ All LCD functions only queue transfers (and delays) and return immediately. Call lcd_task() as often as possible
+ (main loop or timer interrupt): it sends next nibble only when timing deadline of previous one has passed,
+ without busy waiting.
+ while (1) {
+   lcd_task(&lcd);
+   ...
+ }
+ NOTE: if queue is full, LCD functions call lcd_task() until there is space - if lcd_task() is called from
+ interrupt, set LCD_ASYNC_QUEUE_SIZE large enough.
+
+ 6. Busy flag polling (LCD_USE_BUSY_FLAG defined in lcd_user.h, LCD R/W pin connected to MCU):
+ Instead of fixed worst-case delays, LCD busy flag is read before each transfer, which is usually much faster.
+ User implements lcd_read_pin() and lcd_set_pin_input(). If busy flag is not cleared within
+ LCD_BUSY_FLAG_TIMEOUT_US, fixed delays are used from then on. Ignored in LCD_ASYNC mode (polling is blocking).
+
+ 7. Bus options (lcd_user.h):
+ LCD_8BIT_MODE: D0-D7 are connected and each byte is sent with a single enable pulse (default is 4-bit mode, D4-D7).
+ LCD_USE_PORT_WRITE: all data pins are set with a single user lcd_write_data_pins() call (for example,
+ one BSRR write if data pins share a port) instead of one lcd_write_pin() call per data pin.
+
+ 8. I2C PCF8574 backpack (LCD_USE_PCF8574 defined in lcd_user.h, user implements lcd_i2c_write()):
+ RS, E, backlight and D4-D7 states are packed into expander bytes, which are collected in a buffer and sent
+ as a single I2C transaction per LCD function call (for example, whole string), instead of one transaction per
+ pin change. I2C transfer time already covers LCD command execution time, so delays are used only where
+ needed (init, clear). Not available with LCD_8BIT_MODE, LCD_ASYNC or LCD_USE_BUSY_FLAG.
+ Bus and E pin are not used, only I2C address:
+ lcd_t lcd = {.i2c_address = 0x27};
+
+ 9. Non-blocking scrolling text (marquee), user implements lcd_get_ms():
+ lcd_print_str_window() blocks until whole string is scrolled. Instead, start marquee regions once
+ (up to LCD_MAX_MARQUEES at the same time, on all LCDs) and call lcd_marquee_handle() periodically (main loop):
+ lcd_marquee_t alarm_text;
+ lcd_marquee_start(&lcd, &alarm_text, 1, 0, 10, 350, "Alarm: temperature too high ", LCD_MARQUEE_LOOP);
+ while (1) {
+   lcd_marquee_handle(); // each region is redrawn only when its text moves
+   ...
+ }
+ lcd_marquee_stop(&alarm_text);
+ NOTE: string is not copied, it must be valid until marquee is stopped.
+
+ 10. Glyph cache (LCD_USE_GLYPH_CACHE defined in lcd_user.h):
+ Register up to LCD_MAX_GLYPHS custom character bitmaps once. They are uploaded to 8 CGRAM slots only when used
+ and not already resident (least recently used slot is replaced, slots that are not visible are preferred in
+ framebuffer mode). Glyphs are printed with lcd_put_glyph() or inside strings as LCD_GLYPH_ESC + glyph ID:
+ const uint8_t bell[8] = {0x04, 0x0E, 0x0E, 0x0E, 0x1F, 0x00, 0x04, 0x00};
+ lcd_glyph_register(&lcd, 1, bell);
+ lcd_print_str(&lcd, 0, 0, "Alarm \x1B\x01");
+ NOTE: without framebuffer, replaced glyph changes also on LCD positions where it is still displayed.
+ Don't mix lcd_create_char() with glyph cache.
+
+ 11. Multiple LCDs:
+ Each LCD has its own lcd_t object (with its own framebuffer, queue and glyph cache). LCDs can share the same
+ bus object (data, RS and R/W lines), only E pins must be separate:
+ lcd_t lcd_top = {.bus = &lcd_bus, .e = {GPIOA, GPIO_PIN_10}};
+ lcd_t lcd_bottom = {.bus = &lcd_bus, .e = {GPIOA, GPIO_PIN_11}};
+ lcd_init(&lcd_top, 2, 16);
+ lcd_init(&lcd_bottom, 2, 16);
+ ...
+ lcd_refresh(&lcd_top);
+ lcd_refresh(&lcd_bottom);
+ In LCD_ASYNC mode, call lcd_task() for each LCD. Bus is taken only for E pulses of one transfer, so while one
+ LCD executes command, the other one can already receive next character.
  */
 
 // Includes -------------------------------------
-#include <stdio.h>
 #include <string.h>
 
 #include "lcd.h"
 #include "lcd_user.h"
 
 // private functions
-void _lcd_init_pins(void);
-void _lcd_send_command(uint8_t cmd);
-void _lcd_send_command_4_bit(uint8_t cmd);
-void _lcd_send_data(uint8_t data);
-void _lcd_cursor_set(uint8_t row, uint8_t col);
-void _lcd_enable_pulse(void);
+void _lcd_init_pins(lcd_t *lcd);
+void _lcd_send_command(lcd_t *lcd, uint8_t cmd);
+void _lcd_send_command_4_bit(lcd_t *lcd, uint8_t cmd);
+void _lcd_send_data(lcd_t *lcd, uint8_t data);
+void _lcd_write(lcd_t *lcd, uint8_t value, bool rs);
+void _lcd_write_bus(lcd_t *lcd, uint8_t value);
+void _lcd_set_rs(lcd_t *lcd, bool rs);
+void _lcd_flush(lcd_t *lcd);
+void _lcd_set_data_pins(lcd_t *lcd, uint8_t value);
+void _lcd_delay_us(lcd_t *lcd, uint32_t us);
+void _lcd_delay_ms(lcd_t *lcd, uint32_t ms);
+void _lcd_wait_exec(lcd_t *lcd, uint32_t us);
+void _lcd_cursor_set(lcd_t *lcd, uint8_t row, uint8_t col);
+void _lcd_print_float(lcd_t *lcd, uint8_t y, uint8_t x, float num, uint8_t decimals, uint8_t width, bool zero_pad,
+                      bool trim);
+void _lcd_format_number(char *buf, bool negative, uint32_t int_part, uint32_t frac_part, uint8_t decimals,
+                        uint8_t width, bool zero_pad);
+void _lcd_set_ddram_address(lcd_t *lcd, uint8_t row, uint8_t col);
+void _lcd_write_char(lcd_t *lcd, uint8_t data);
+void _lcd_marquee_draw(lcd_marquee_t *marquee);
+void _lcd_write_glyph(lcd_t *lcd, uint8_t id);
+void _lcd_enable_pulse(lcd_t *lcd);
 
 // Private variables
-typedef struct
-{
-  uint8_t display_ctrl;
-  uint8_t display_function;
-  uint8_t display_mode;
-  uint8_t rows;
-  uint8_t cols;
-  uint8_t current_x;
-  uint8_t current_y;
-} lcd_options_t;
+static lcd_marquee_t *_lcd_marquees[LCD_MAX_MARQUEES]; // started marquee regions, NULL if slot is free
+
+#ifdef LCD_ASYNC
+// Queue entry: delay [15] = 1, [14:0] microseconds; transfer [9] = single bus write, [8] = RS, [7:0] data/command
+#define LCD_QUEUE_DELAY 0x8000
+#define LCD_QUEUE_DELAY_MAX_US 0x7FFF
+#define LCD_QUEUE_SINGLE 0x0200
+#define LCD_QUEUE_RS 0x0100
+
+void _lcd_queue_put(lcd_t *lcd, uint16_t entry);
+#endif
+
+#ifdef LCD_USE_PCF8574
+// PCF8574 backpack pins: P0 = RS, P1 = R/W (always low), P2 = E, P3 = backlight, P4-P7 = D4-D7
+#define LCD_PCF8574_RS 0x01
+#define LCD_PCF8574_E 0x04
+#define LCD_PCF8574_BACKLIGHT 0x08
+
+void _lcd_i2c_put(lcd_t *lcd, uint8_t data);
+#endif
 
-static lcd_options_t _lcd_options;
+#ifdef LCD_USE_GLYPH_CACHE
+uint8_t _lcd_glyph_slot(lcd_t *lcd, uint8_t id);
+uint8_t _lcd_glyph_victim(lcd_t *lcd);
+#endif
+
+#ifdef LCD_USE_BUSY_FLAG
+void _lcd_wait_busy_flag(lcd_t *lcd);
+void _lcd_set_data_pins_input(lcd_t *lcd, bool input);
+#endif
 
 // Private defines -------------------------------------*/
 // Commands
@@ -96,6 +206,27 @@ static lcd_options_t _lcd_options;
 #define LCD_MOVERIGHT 0x04
 #define LCD_MOVELEFT 0x00
 
+// Number formatting
+#define LCD_NUM_MAX_DECIMALS 9 // 10^9 still fits in uint32_t
+#define LCD_NUM_BUFF_SIZE 24   // sign + 10 integer digits + '.' + 9 decimals, or padding up to 23 characters
+
+static const uint32_t _lcd_pow10[LCD_NUM_MAX_DECIMALS + 1] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000};
+
+// Data pins (index in lcd_bus_t.d)
+#ifdef LCD_8BIT_MODE
+#define LCD_FIRST_DATA_PIN 0 // D0-D7
+#else
+#define LCD_FIRST_DATA_PIN 4 // D4-D7
+#endif
+
+// Timing
+#define LCD_ENABLE_PULSE_US 2         // E pulse width
+#define LCD_EXEC_TIME_US 100          // wait time after each transfer
+#define LCD_CLEAR_TIME_US 3000        // wait time after clear display command
+#define LCD_ENTRY_MODE_TIME_US 5000   // wait time after entry mode set command (init)
+#define LCD_BUSY_FLAG_TIMEOUT_US 5000 // busy flag polling timeout, must be longer than any command execution time
+
 // Flags for function set
 #define LCD_8BITMODE 0x10
 #define LCD_4BITMODE 0x00
@@ -106,139 +237,200 @@ static lcd_options_t _lcd_options;
 
 /**
  * @brief  Initializes LCD (HD44780)
+ * @param  lcd - pointer to LCD object with set connection (bus and E pin, or I2C address)
  * @param  rows - height of lcd (>= 1)
  * @param  cols - width of lcdNone (>= 1)
  */
-void lcd_init(uint8_t rows, uint8_t cols)
+void lcd_init(lcd_t *lcd, uint8_t rows, uint8_t cols)
 {
+#ifdef LCD_USE_FRAMEBUFFER
+  // LCD size is limited by framebuffer size
+  if (rows > LCD_MAX_ROWS)
+  {
+    rows = LCD_MAX_ROWS;
+  }
+  if (cols > LCD_MAX_COLS)
+  {
+    cols = LCD_MAX_COLS;
+  }
+#endif
+
   // Set LCD width and height
-  _lcd_options.rows = rows;
-  _lcd_options.cols = cols;
+  lcd->rows = rows;
+  lcd->cols = cols;
   // Set cursor pointer to beginning for LCD
-  _lcd_options.current_x = 0;
-  _lcd_options.current_y = 0;
+  lcd->current_x = 0;
+  lcd->current_y = 0;
 
-  _lcd_options.display_function = LCD_4BITMODE | LCD_5x8DOTS | LCD_1LINE;
+#ifdef LCD_8BIT_MODE
+  lcd->display_function = LCD_8BITMODE | LCD_5x8DOTS | LCD_1LINE;
+#else
+  lcd->display_function = LCD_4BITMODE | LCD_5x8DOTS | LCD_1LINE;
+#endif
   if (rows > 1)
   {
-    _lcd_options.display_function |= LCD_2LINE;
+    lcd->display_function |= LCD_2LINE;
   }
 
   lcd_init_pins(); // call user pin initialization function
+#ifdef LCD_USE_PCF8574
+  if (lcd->i2c_address == 0)
+  {
+    lcd->i2c_address = LCD_PCF8574_ADDRESS;
+  }
+  lcd->i2c.len = 0;
+  lcd->i2c.ctrl = LCD_PCF8574_BACKLIGHT;
+#endif
+#ifdef LCD_ASYNC
+  ring_buffer_init_static_elem(&lcd->queue, lcd->queue_buff, LCD_ASYNC_QUEUE_SIZE, sizeof(lcd->queue_buff[0]));
+  lcd->async.step = LCD_ASYNC_IDLE;
+  lcd->async.timestamp = lcd_get_us();
+  lcd->async.wait_us = 0;
+#endif
+#ifdef LCD_USE_GLYPH_CACHE
+  memset(&lcd->glyphs, 0, sizeof(lcd->glyphs));
+#endif
+#ifdef LCD_USE_BUSY_FLAG
+  lcd_write_pin(lcd->bus->rw.port, lcd->bus->rw.pin, false); // write mode
+  lcd->busy_flag_valid = true;
+#endif
 
-  // Try to set 4bit mode
-  _lcd_send_command_4_bit(0x03);
-  lcd_delay_ms(5);
+  // Try to set 8bit mode (reset sequence, LCD can be in any mode after power-up)
+  _lcd_send_command_4_bit(lcd, 0x03);
+  _lcd_delay_ms(lcd, 5);
 
   // Second try
-  _lcd_send_command_4_bit(0x03);
-  lcd_delay_ms(5);
+  _lcd_send_command_4_bit(lcd, 0x03);
+  _lcd_delay_ms(lcd, 5);
 
   // Third go!
-  _lcd_send_command_4_bit(0x03);
-  lcd_delay_ms(5);
+  _lcd_send_command_4_bit(lcd, 0x03);
+  _lcd_delay_ms(lcd, 5);
 
+#ifndef LCD_8BIT_MODE
   // Set 4-bit interface
-  _lcd_send_command_4_bit(0x02);
-  lcd_delay_us(100);
+  _lcd_send_command_4_bit(lcd, 0x02);
+  _lcd_delay_us(lcd, 100);
+#endif
 
   // Set # lines, font size, etc.
-  _lcd_send_command(LCD_FUNCTIONSET | _lcd_options.display_function);
+  _lcd_send_command(lcd, LCD_FUNCTIONSET | lcd->display_function);
 
   // Turn the display on, no cursor, no blinking
-  _lcd_options.display_ctrl = LCD_DISPLAYON;
-  lcd_display_on();
-
-  lcd_clear();
+  lcd->display_ctrl = LCD_DISPLAYON;
+  lcd_display_on(lcd);
+
+  _lcd_send_command(lcd, LCD_CLEARDISPLAY);
+  _lcd_wait_exec(lcd, LCD_CLEAR_TIME_US);
+#ifdef LCD_USE_FRAMEBUFFER
+  memset(lcd->fb, ' ', sizeof(lcd->fb));
+  memset(lcd->screen, ' ', sizeof(lcd->screen));
+#endif
 
   // Default font & direction
-  _lcd_options.display_mode = LCD_ENTRYLEFT | LCD_ENTRYSHIFTDECREMENT;
-  _lcd_send_command(LCD_ENTRYMODESET | _lcd_options.display_mode);
-  lcd_delay_ms(5);
+  lcd->display_mode = LCD_ENTRYLEFT | LCD_ENTRYSHIFTDECREMENT;
+  _lcd_send_command(lcd, LCD_ENTRYMODESET | lcd->display_mode);
+  _lcd_wait_exec(lcd, LCD_ENTRY_MODE_TIME_US);
 }
 
 /**
  * @brief  Print string on lcd
+ * @param  lcd - pointer to LCD object
  * @param  y - row (starts with 0)
  * @param  x - column  (starts with 0)
  * @param  *str - pointer to string to display
  */
-void lcd_print_str(uint8_t y, uint8_t x, char *str)
+void lcd_print_str(lcd_t *lcd, uint8_t y, uint8_t x, char *str)
 {
-  _lcd_cursor_set(y, x);
+  _lcd_cursor_set(lcd, y, x);
   while (*str)
   {
 #ifdef LCD_GO_TO_NEW_LINE_IF_STRING_TOO_LONG
-    if (_lcd_options.current_x >= _lcd_options.cols)
+    if (lcd->current_x >= lcd->cols)
     {
-      _lcd_options.current_x = 0;
-      _lcd_options.current_y++;
-      _lcd_cursor_set(_lcd_options.current_y, _lcd_options.current_x);
+      lcd->current_x = 0;
+      lcd->current_y++;
+      _lcd_cursor_set(lcd, lcd->current_y, lcd->current_x);
     }
     if (*str == '\n')
     {
-      _lcd_options.current_y++;
-      _lcd_cursor_set(_lcd_options.current_y, _lcd_options.current_x);
+      lcd->current_y++;
+      _lcd_cursor_set(lcd, lcd->current_y, lcd->current_x);
     }
     else if (*str == '\r')
     {
-      _lcd_cursor_set(_lcd_options.current_y, 0);
+      _lcd_cursor_set(lcd, lcd->current_y, 0);
+    }
+#ifdef LCD_USE_GLYPH_CACHE
+    else if ((*str == LCD_GLYPH_ESC) && (*(str + 1) != '\0'))
+    { // next character is glyph ID
+      str++;
+      _lcd_write_glyph(lcd, (uint8_t)*str);
     }
+#endif
     else
     {
-      _lcd_send_data(*str);
-      _lcd_options.current_x++;
+      _lcd_write_char(lcd, *str);
     }
     str++;
 #else
     if (*str == '\n')
     {
-      _lcd_options.current_y++;
-      _lcd_cursor_set(_lcd_options.current_y, _lcd_options.current_x);
+      lcd->current_y++;
+      _lcd_cursor_set(lcd, lcd->current_y, lcd->current_x);
     }
     else if (*str == '\r')
     {
-      _lcd_cursor_set(_lcd_options.current_y, 0);
+      _lcd_cursor_set(lcd, lcd->current_y, 0);
     }
+#ifdef LCD_USE_GLYPH_CACHE
+    else if ((*str == LCD_GLYPH_ESC) && (*(str + 1) != '\0'))
+    { // next character is glyph ID
+      str++;
+      _lcd_write_glyph(lcd, (uint8_t)*str);
+    }
+#endif
     else
     {
-      _lcd_send_data(*str);
-      _lcd_options.current_x++;
+      _lcd_write_char(lcd, *str);
     }
     str++;
 #endif
   }
+  _lcd_flush(lcd);
 }
 
 /**
  * @brief  Print string and scroll it (right to left) on LCD in specific window size.
+ *         This function blocks until whole string is scrolled, see lcd_marquee_start() for non-blocking option.
+ * @param  lcd - pointer to LCD object
  * @param  window_size - number of characters from x position, where string will be displayed
  * @param  y - row (starts with 0)
  * @param  x - column  (starts with 0)
  * @param  str - pointer to string to display
  */
-void lcd_print_str_window(uint8_t y, uint8_t x, uint8_t window_size, uint16_t speed_ms, char *str)
+void lcd_print_str_window(lcd_t *lcd, uint8_t y, uint8_t x, uint8_t window_size, uint16_t speed_ms, char *str)
 {
 
   uint8_t _window_character_number = 0;
-  uint8_t string_length = strlen(str); // number of characters in passed string
-  uint8_t _str_character_number = 0;   // 0 - strlen(str)
+  uint16_t string_length = strlen(str); // number of characters in passed string
+  uint16_t _str_character_number = 0;   // 0 - strlen(str)
   char *_str = str;
 
-  _lcd_cursor_set(y, x);
+  _lcd_cursor_set(lcd, y, x);
 
   if (string_length > window_size)
   { // string is larger than window size. String must be scrolled
     // write character while they are inside window size
     while (_str_character_number < window_size)
     {
-      _lcd_send_data(*_str);
+      _lcd_write_char(lcd, *_str);
 
-      _lcd_options.current_x++;
       _str_character_number++;
       _str++;
     }
-    lcd_delay_ms(LCD_WINDOW_PRINT_DELAY_MS);
+    lcd_refresh(lcd);
+    _lcd_delay_ms(lcd, LCD_WINDOW_PRINT_DELAY_MS);
 
     _str_character_number = 0;
     _str = str++; // increment starting character
@@ -247,218 +439,1147 @@ void lcd_print_str_window(uint8_t y, uint8_t x, uint8_t window_size, uint16_t sp
     while ((string_length - _str_character_number) >= window_size)
     {
       _window_character_number = 0; // reset character position in window.
-      _lcd_cursor_set(y, x);
+      _lcd_cursor_set(lcd, y, x);
 
       while (_window_character_number < window_size)
-      {                             // while character number is smaller than window size
-        _lcd_send_data(*_str);      // print character
-        _lcd_options.current_x++;   // increment x position
-        _window_character_number++; // increment position in window
-        _str++;                     // increment starting character
+      {                              // while character number is smaller than window size
+        _lcd_write_char(lcd, *_str); // print character, increment x position
+        _window_character_number++;  // increment position in window
+        _str++;                      // increment starting character
       }
 
       _str = str++; // increment starting character
       _str_character_number++;
 
-      lcd_delay_ms(speed_ms);
+      lcd_refresh(lcd);
+      _lcd_delay_ms(lcd, speed_ms);
     }
   }
   else
   { // string is smaller than window size. Print it normally.
-    lcd_print_str(y, x, str);
+    lcd_print_str(lcd, y, x, str);
   }
 }
 
 /**
- * @brief  Print string and scroll it (right to left) on LCD in specific window size.
+ * @brief  Start non-blocking scrolling of string (right to left) on LCD in specific window size.
+ *         String is scrolled by lcd_marquee_handle() calls. If string already fits in window, it is printed
+ *         normally and marquee is not started.
+ * @param  lcd - pointer to LCD object
+ * @param  marquee - pointer to user marquee object, must be valid until lcd_marquee_stop()
+ * @param  y - row (starts with 0)
+ * @param  x - column  (starts with 0)
+ * @param  window_size - number of characters from x position, where string will be displayed
+ * @param  speed_ms - time between two scroll steps
+ * @param  str - pointer to string to display, must be valid until lcd_marquee_stop()
+ * @param  mode - LCD_MARQUEE_LOOP or LCD_MARQUEE_PING_PONG
+ * @retval true on success, false if all LCD_MAX_MARQUEES marquees are already started
+ */
+bool lcd_marquee_start(lcd_t *lcd, lcd_marquee_t *marquee, uint8_t y, uint8_t x, uint8_t window_size,
+                       uint16_t speed_ms, const char *str, lcd_marquee_mode_t mode)
+{
+  size_t length;
+  uint8_t i;
+  int8_t free_slot = -1;
+
+  for (i = 0; i < LCD_MAX_MARQUEES; i++)
+  {
+    if (_lcd_marquees[i] == marquee)
+    { // restart of already started marquee
+      free_slot = i;
+      break;
+    }
+    if ((_lcd_marquees[i] == NULL) && (free_slot < 0))
+    {
+      free_slot = i;
+    }
+  }
+  if (free_slot < 0)
+  {
+    return false;
+  }
+  _lcd_marquees[free_slot] = NULL;
+
+  marquee->lcd = lcd;
+  marquee->str = str;
+  marquee->y = y;
+  marquee->x = x;
+  marquee->window_size = window_size;
+  marquee->speed_ms = speed_ms;
+  marquee->mode = mode;
+  length = strlen(str);
+  marquee->length = (length > UINT16_MAX) ? UINT16_MAX : (uint16_t)length; // longer strings end at UINT16_MAX
+  marquee->offset = 0;
+  marquee->reverse = false;
+
+  if (marquee->length <= window_size)
+  { // string fits in window, no need to scroll
+    lcd_print_str(lcd, y, x, (char *)str);
+    return true;
+  }
+
+  // show static view first
+  _lcd_marquee_draw(marquee);
+  marquee->timestamp = lcd_get_ms();
+  marquee->wait_ms = LCD_WINDOW_PRINT_DELAY_MS;
+
+  _lcd_marquees[free_slot] = marquee;
+
+  return true;
+}
+
+/**
+ * @brief  Stop scrolling of marquee region. Currently displayed characters stay on LCD.
+ * @param  marquee - pointer to marquee object, started with lcd_marquee_start()
+ */
+void lcd_marquee_stop(lcd_marquee_t *marquee)
+{
+  uint8_t i;
+
+  for (i = 0; i < LCD_MAX_MARQUEES; i++)
+  {
+    if (_lcd_marquees[i] == marquee)
+    {
+      _lcd_marquees[i] = NULL;
+    }
+  }
+}
+
+/**
+ * @brief  Scroll all started marquee regions. Call this function periodically (main loop), it never waits.
+ *         Each region is redrawn only when its scroll step time has passed. At both ends of string,
+ *         text stays still for LCD_WINDOW_PRINT_DELAY_MS.
+ */
+void lcd_marquee_handle(void)
+{
+  uint32_t now = lcd_get_ms();
+  lcd_marquee_t *marquee;
+  uint16_t last;
+  uint8_t i;
+
+  for (i = 0; i < LCD_MAX_MARQUEES; i++)
+  {
+    marquee = _lcd_marquees[i];
+    if ((marquee == NULL) || ((uint32_t)(now - marquee->timestamp) < marquee->wait_ms))
+    {
+      continue;
+    }
+    last = marquee->length - marquee->window_size; // offset of the last window
+
+    if (!marquee->reverse && (marquee->offset >= last))
+    { // end of string is shown
+      if (marquee->mode == LCD_MARQUEE_LOOP)
+      {
+        marquee->offset = 0;
+      }
+      else
+      {
+        marquee->reverse = true;
+        marquee->offset--;
+      }
+    }
+    else if (marquee->reverse && (marquee->offset == 0))
+    { // beginning of string is shown (ping-pong)
+      marquee->reverse = false;
+      marquee->offset++;
+    }
+    else if (marquee->reverse)
+    {
+      marquee->offset--;
+    }
+    else
+    {
+      marquee->offset++;
+    }
+    _lcd_marquee_draw(marquee);
+
+    marquee->timestamp = now;
+    if ((marquee->offset == 0) || (marquee->offset == last))
+    {
+      marquee->wait_ms = LCD_WINDOW_PRINT_DELAY_MS;
+    }
+    else
+    {
+      marquee->wait_ms = marquee->speed_ms;
+    }
+  }
+}
+
+/**
+ * @brief  Print integer number on LCD
+ * @param  lcd - pointer to LCD object
  * @param  y - row (starts with 0)
  * @param  x - column  (starts with 0)
  * @param  num - integer number
  */
-void lcd_print_int(uint8_t y, uint8_t x, int32_t num)
+void lcd_print_int(lcd_t *lcd, uint8_t y, uint8_t x, int32_t num)
 {
-  char buf[_lcd_options.cols];
-  snprintf(buf, sizeof(buf), "%d", (int)num);
-  lcd_print_str(y, x, buf);
+  lcd_print_fixed(lcd, y, x, num, 0, 0, false);
 }
 
 /**
- * @brief  Print string and scroll it (right to left) on LCD in specific window size.
+ * @brief  Print integer number on LCD, right-aligned in fixed width field. Previous (longer) value is
+ *         overwritten, so no separate clear is needed.
+ * @param  lcd - pointer to LCD object
+ * @param  y - row (starts with 0)
+ * @param  x - column  (starts with 0)
+ * @param  num - integer number
+ * @param  width - minimum number of printed characters (0 = no alignment)
+ * @param  zero_pad - true to pad with leading zeros ("-007"), false to pad with spaces ("  -7")
+ */
+void lcd_print_int_width(lcd_t *lcd, uint8_t y, uint8_t x, int32_t num, uint8_t width, bool zero_pad)
+{
+  lcd_print_fixed(lcd, y, x, num, 0, width, zero_pad);
+}
+
+/**
+ * @brief  Print fixed-point number on LCD, without any float operations.
+ * @param  lcd - pointer to LCD object
+ * @param  y - row (starts with 0)
+ * @param  x - column  (starts with 0)
+ * @param  num - number scaled by 10^decimals (for example, 2345 with 2 decimals is printed as "23.45")
+ * @param  decimals - number of decimal places (0 - 9)
+ * @param  width - minimum number of printed characters (0 = no alignment), number is right-aligned
+ * @param  zero_pad - true to pad with leading zeros, false to pad with spaces
+ */
+void lcd_print_fixed(lcd_t *lcd, uint8_t y, uint8_t x, int32_t num, uint8_t decimals, uint8_t width, bool zero_pad)
+{
+  char buf[LCD_NUM_BUFF_SIZE];
+  uint32_t abs_num = (num < 0) ? (0 - (uint32_t)num) : (uint32_t)num;
+
+  if (decimals > LCD_NUM_MAX_DECIMALS)
+  {
+    decimals = LCD_NUM_MAX_DECIMALS;
+  }
+  _lcd_format_number(buf, (num < 0), abs_num / _lcd_pow10[decimals], abs_num % _lcd_pow10[decimals], decimals,
+                     width, zero_pad);
+  lcd_print_str(lcd, y, x, buf);
+}
+
+/**
+ * @brief  Print float number on LCD (similar to "%g", but without exponent notation and printf).
+ *         Trailing zeros are removed. If number is too large, "ovf" is printed ("nan" for NaN).
+ * @param  lcd - pointer to LCD object
  * @param  y - row
  * @param  x - column
  * @param  num - float number
- * @param  precision - number of digits to be displayed
+ * @param  precision - number of significant digits to be displayed
  */
-void lcd_print_float(uint8_t y, uint8_t x, float num, uint8_t precision)
+void lcd_print_float(lcd_t *lcd, uint8_t y, uint8_t x, float num, uint8_t precision)
 {
-  char buf[_lcd_options.cols];
+  float abs_num = (num < 0) ? -num : num;
+  uint8_t digits = 1;
+  uint8_t decimals = 0;
 
-  snprintf(buf, sizeof(buf), "%.*g", precision, num);
-  lcd_print_str(y, x, buf);
+  if (precision == 0)
+  {
+    precision = 1;
+  }
+
+  if (abs_num >= 1.0f)
+  { // number of integer digits
+    while ((digits < 10) && (abs_num >= (float)_lcd_pow10[digits]))
+    {
+      digits++;
+    }
+  }
+  else if (abs_num > 0.0f)
+  { // integer zero and leading zeros after decimal point are not significant
+    digits = 0;
+    while ((decimals < LCD_NUM_MAX_DECIMALS) && ((abs_num * (float)_lcd_pow10[decimals + 1]) < 1.0f))
+    {
+      decimals++;
+    }
+  }
+  if (precision > digits)
+  {
+    decimals += precision - digits;
+  }
+
+  _lcd_print_float(lcd, y, x, num, decimals, 0, false, true);
+}
+
+/**
+ * @brief  Print float number on LCD with fixed number of decimals, right-aligned in fixed width field.
+ *         If number is too large, "ovf" is printed ("nan" for NaN).
+ * @param  lcd - pointer to LCD object
+ * @param  y - row
+ * @param  x - column
+ * @param  num - float number
+ * @param  decimals - number of decimal places (0 - 9)
+ * @param  width - minimum number of printed characters (0 = no alignment)
+ * @param  zero_pad - true to pad with leading zeros, false to pad with spaces
+ */
+void lcd_print_float_width(lcd_t *lcd, uint8_t y, uint8_t x, float num, uint8_t decimals, uint8_t width,
+                           bool zero_pad)
+{
+  _lcd_print_float(lcd, y, x, num, decimals, width, zero_pad, false);
 }
 
-void lcd_clear(void)
+void lcd_clear(lcd_t *lcd)
 {
-  _lcd_send_command(LCD_CLEARDISPLAY);
-  lcd_delay_ms(3);
+#ifdef LCD_USE_FRAMEBUFFER
+  // only framebuffer is cleared, changed characters are sent with lcd_refresh()
+  memset(lcd->fb, ' ', sizeof(lcd->fb));
+#else
+  _lcd_send_command(lcd, LCD_CLEARDISPLAY);
+  _lcd_wait_exec(lcd, LCD_CLEAR_TIME_US);
+#endif
 }
 
-void lcd_clear_area(uint8_t y, uint8_t x_start, uint8_t x_end)
+void lcd_clear_area(lcd_t *lcd, uint8_t y, uint8_t x_start, uint8_t x_end)
 {
   uint8_t x = x_start;
   while (x <= x_end)
   {
-    lcd_print_str(y, x, " ");
+    lcd_print_str(lcd, y, x, " ");
     x++;
   }
 }
 
-void lcd_display_on(void)
+void lcd_display_on(lcd_t *lcd)
 {
-  _lcd_options.display_ctrl |= LCD_DISPLAYON;
-  _lcd_send_command(LCD_DISPLAYCONTROL | _lcd_options.display_ctrl);
+  lcd->display_ctrl |= LCD_DISPLAYON;
+  _lcd_send_command(lcd, LCD_DISPLAYCONTROL | lcd->display_ctrl);
 }
 
-void lcd_display_off(void)
+void lcd_display_off(lcd_t *lcd)
 {
-  _lcd_options.display_ctrl &= ~LCD_DISPLAYON;
-  _lcd_send_command(LCD_DISPLAYCONTROL | _lcd_options.display_ctrl);
+  lcd->display_ctrl &= ~LCD_DISPLAYON;
+  _lcd_send_command(lcd, LCD_DISPLAYCONTROL | lcd->display_ctrl);
 }
 
-void lcd_blink_on(void)
+void lcd_blink_on(lcd_t *lcd)
 {
-  _lcd_options.display_ctrl |= LCD_BLINKON;
-  _lcd_send_command(LCD_DISPLAYCONTROL | _lcd_options.display_ctrl);
+  lcd->display_ctrl |= LCD_BLINKON;
+  _lcd_send_command(lcd, LCD_DISPLAYCONTROL | lcd->display_ctrl);
 }
 
-void lcd_blink_off(void)
+void lcd_blink_off(lcd_t *lcd)
 {
-  _lcd_options.display_ctrl &= ~LCD_BLINKON;
-  _lcd_send_command(LCD_DISPLAYCONTROL | _lcd_options.display_ctrl);
+  lcd->display_ctrl &= ~LCD_BLINKON;
+  _lcd_send_command(lcd, LCD_DISPLAYCONTROL | lcd->display_ctrl);
 }
 
-void lcd_cursor_on(void)
+void lcd_cursor_on(lcd_t *lcd)
 {
-  _lcd_options.display_ctrl |= LCD_CURSORON;
-  _lcd_send_command(LCD_DISPLAYCONTROL | _lcd_options.display_ctrl);
+  lcd->display_ctrl |= LCD_CURSORON;
+  _lcd_send_command(lcd, LCD_DISPLAYCONTROL | lcd->display_ctrl);
 }
 
-void lcd_cursor_off(void)
+void lcd_cursor_off(lcd_t *lcd)
 {
-  _lcd_options.display_ctrl &= ~LCD_CURSORON;
-  _lcd_send_command(LCD_DISPLAYCONTROL | _lcd_options.display_ctrl);
+  lcd->display_ctrl &= ~LCD_CURSORON;
+  _lcd_send_command(lcd, LCD_DISPLAYCONTROL | lcd->display_ctrl);
 }
 
-void lcd_scroll_left(void)
+void lcd_scroll_left(lcd_t *lcd)
 {
-  _lcd_send_command(LCD_CURSORSHIFT | LCD_DISPLAYMOVE | LCD_MOVELEFT);
+  _lcd_send_command(lcd, LCD_CURSORSHIFT | LCD_DISPLAYMOVE | LCD_MOVELEFT);
 }
 
-void lcd_scroll_right(void)
+void lcd_scroll_right(lcd_t *lcd)
 {
-  _lcd_send_command(LCD_CURSORSHIFT | LCD_DISPLAYMOVE | LCD_MOVERIGHT);
+  _lcd_send_command(lcd, LCD_CURSORSHIFT | LCD_DISPLAYMOVE | LCD_MOVERIGHT);
 }
 
 /**
  * @brief Creates custom character at specific location
+ * @param lcd - pointer to LCD object
  * @param location - LCD memory location (LCD supports up to 8 custom characters, locations: 0 - 7)
  * @param data - Pointer to 8-bytes of data for one character
  * @retval None
  */
-void lcd_create_char(uint8_t location, uint8_t *data)
+void lcd_create_char(lcd_t *lcd, uint8_t location, uint8_t *data)
 {
   uint8_t i;
   // We have 8 locations available for custom characters
   location &= 0x07;
-  _lcd_send_command(LCD_SETCGRAMADDR | (location << 3));
+#ifdef LCD_USE_GLYPH_CACHE
+  lcd->glyphs.slot_glyph[location] = 0; // slot content is not a cached glyph anymore
+#endif
+  _lcd_send_command(lcd, LCD_SETCGRAMADDR | (location << 3));
 
   for (i = 0; i < 8; i++)
   {
-    _lcd_send_data(data[i]);
+    _lcd_send_data(lcd, data[i]);
   }
+  _lcd_flush(lcd);
 }
 
 /**
  *  @brief Puts custom created character on LCD
+ * @param  lcd - pointer to LCD object
  * @param  y - row
  * @param  x - column
  * @param  location: Location on LCD where character is stored, 0 - 7
  */
-void lcd_put_char(uint8_t y, uint8_t x, uint8_t location)
+void lcd_put_char(lcd_t *lcd, uint8_t y, uint8_t x, uint8_t location)
+{
+  _lcd_cursor_set(lcd, y, x);
+  _lcd_write_char(lcd, location);
+  _lcd_flush(lcd);
+}
+
+/**
+ * @brief Puts characters on LCD as they are (custom characters 0 - 7 and any other codes, no control characters),
+ *        cursor is set only once.
+ * @param  lcd - pointer to LCD object
+ * @param  y - row
+ * @param  x - column of the first character
+ * @param  data - pointer to character codes
+ * @param  len - number of characters
+ */
+void lcd_put_chars(lcd_t *lcd, uint8_t y, uint8_t x, const uint8_t *data, uint8_t len)
+{
+  uint8_t i;
+
+  _lcd_cursor_set(lcd, y, x);
+  for (i = 0; i < len; i++)
+  {
+    _lcd_write_char(lcd, data[i]);
+  }
+  _lcd_flush(lcd);
+}
+
+/**
+ * @brief Register custom character bitmap in glyph cache (LCD_USE_GLYPH_CACHE mode).
+ *        Bitmap is uploaded to LCD CGRAM only when glyph is printed and not already resident.
+ *        Registering new bitmap with the same ID replaces the old one.
+ * @param lcd - pointer to LCD object
+ * @param id - glyph ID, 1 - LCD_MAX_GLYPHS
+ * @param bitmap - pointer to 8 bytes of character data (not copied, must be valid while glyph is used)
+ * @retval true on success, false if ID is invalid (always false without LCD_USE_GLYPH_CACHE)
+ */
+bool lcd_glyph_register(lcd_t *lcd, uint8_t id, const uint8_t *bitmap)
+{
+#ifdef LCD_USE_GLYPH_CACHE
+  uint8_t slot;
+
+  if ((id == 0) || (id > LCD_MAX_GLYPHS))
+  {
+    return false;
+  }
+  lcd->glyphs.bitmaps[id - 1] = bitmap;
+
+  for (slot = 0; slot < LCD_CGRAM_SLOTS; slot++)
+  {
+    if (lcd->glyphs.slot_glyph[slot] == id)
+    { // old bitmap is resident, upload again on next use
+      lcd->glyphs.slot_glyph[slot] = 0;
+    }
+  }
+  return true;
+#else
+  (void)lcd;
+  (void)id;
+  (void)bitmap;
+  return false;
+#endif
+}
+
+/**
+ * @brief Print registered glyph on LCD (LCD_USE_GLYPH_CACHE mode), upload it to CGRAM if needed.
+ * @param lcd - pointer to LCD object
+ * @param y - row
+ * @param x - column
+ * @param id - glyph ID, 1 - LCD_MAX_GLYPHS
+ */
+void lcd_put_glyph(lcd_t *lcd, uint8_t y, uint8_t x, uint8_t id)
+{
+#ifdef LCD_USE_GLYPH_CACHE
+  _lcd_cursor_set(lcd, y, x);
+  _lcd_write_glyph(lcd, id);
+  _lcd_flush(lcd);
+#else
+  (void)lcd;
+  (void)y;
+  (void)x;
+  (void)id;
+#endif
+}
+
+/**
+ * @brief Send changed characters from framebuffer to LCD (LCD_USE_FRAMEBUFFER mode).
+ *        Adjacent changed characters are sent as one run after a single cursor set command,
+ *        unchanged characters are not sent at all.
+ *        Without LCD_USE_FRAMEBUFFER, characters are sent immediately and this function does nothing.
+ * @param lcd - pointer to LCD object
+ */
+void lcd_refresh(lcd_t *lcd)
+{
+#ifdef LCD_USE_FRAMEBUFFER
+  uint8_t row, col;
+  bool in_run;
+
+  for (row = 0; row < lcd->rows; row++)
+  {
+    in_run = false;
+    for (col = 0; col < lcd->cols; col++)
+    {
+      if (lcd->fb[row][col] != lcd->screen[row][col])
+      {
+        if (!in_run)
+        { // first changed character: set address once, LCD increments it after each character
+          _lcd_set_ddram_address(lcd, row, col);
+          in_run = true;
+        }
+        _lcd_send_data(lcd, lcd->fb[row][col]);
+        lcd->screen[row][col] = lcd->fb[row][col];
+      }
+      else
+      {
+        in_run = false;
+      }
+    }
+  }
+  _lcd_flush(lcd);
+#else
+  (void)lcd;
+#endif
+}
+
+/**
+ * @brief Send next queued transfer step to LCD (LCD_ASYNC mode). Call this function as often as possible,
+ *        in main loop or timer interrupt. It returns immediately if timing deadline of previous step
+ *        has not passed yet, and never waits.
+ *        Without LCD_ASYNC, transfers are sent immediately and this function does nothing.
+ * @param lcd - pointer to LCD object
+ */
+void lcd_task(lcd_t *lcd)
+{
+#ifdef LCD_ASYNC
+  uint32_t now;
+
+  if ((lcd->bus->owner != NULL) && (lcd->bus->owner != lcd))
+  { // other LCD on the same bus is in the middle of transfer, let it finish first
+    lcd_task(lcd->bus->owner);
+    if (lcd->bus->owner != NULL)
+    {
+      return;
+    }
+  }
+  now = lcd_get_us();
+
+  // process steps until next deadline is in the future or queue is empty
+  while ((uint32_t)(now - lcd->async.timestamp) >= lcd->async.wait_us)
+  {
+    lcd->async.timestamp = now;
+    lcd->async.wait_us = 0;
+
+    switch (lcd->async.step)
+    {
+    case LCD_ASYNC_IDLE:
+      if (ring_buffer_get(&lcd->queue, &lcd->async.entry, 1) != RB_OK)
+      { // nothing to send
+        return;
+      }
+      if (lcd->async.entry & LCD_QUEUE_DELAY)
+      {
+        lcd->async.wait_us = lcd->async.entry & LCD_QUEUE_DELAY_MAX_US;
+        break;
+      }
+
+      lcd->bus->owner = lcd; // bus is taken until E pulses are finished
+      lcd_write_pin(lcd->bus->rs.port, lcd->bus->rs.pin, (bool)(lcd->async.entry & LCD_QUEUE_RS));
+      _lcd_set_data_pins(lcd, (uint8_t)lcd->async.entry); // whole byte (8-bit mode) or high nibble
+      lcd_write_pin(lcd->e.port, lcd->e.pin, true);
+      lcd->async.wait_us = LCD_ENABLE_PULSE_US;
+      lcd->async.step = LCD_ASYNC_HIGH_PULSE;
+      break;
+
+    case LCD_ASYNC_HIGH_PULSE:
+      lcd_write_pin(lcd->e.port, lcd->e.pin, false);
+      if (lcd->async.entry & LCD_QUEUE_SINGLE)
+      {
+        lcd->bus->owner = NULL;
+        lcd->async.wait_us = LCD_EXEC_TIME_US;
+        lcd->async.step = LCD_ASYNC_IDLE;
+      }
+      else
+      {
+        lcd->async.wait_us = LCD_ENABLE_PULSE_US;
+        lcd->async.step = LCD_ASYNC_LOW_NIBBLE;
+      }
+      break;
+
+    case LCD_ASYNC_LOW_NIBBLE:
+      _lcd_set_data_pins(lcd, (uint8_t)(lcd->async.entry << 4));
+      lcd_write_pin(lcd->e.port, lcd->e.pin, true);
+      lcd->async.wait_us = LCD_ENABLE_PULSE_US;
+      lcd->async.step = LCD_ASYNC_LOW_PULSE;
+      break;
+
+    case LCD_ASYNC_LOW_PULSE:
+    default:
+      lcd_write_pin(lcd->e.port, lcd->e.pin, false);
+      lcd->bus->owner = NULL;
+      lcd->async.wait_us = LCD_EXEC_TIME_US;
+      lcd->async.step = LCD_ASYNC_IDLE;
+      break;
+    }
+  }
+#else
+  (void)lcd;
+#endif
+}
+
+/**
+ * @brief Check if there are LCD transfers still waiting to be sent by lcd_task() (LCD_ASYNC mode).
+ *        LCD is also busy until delay or execution time of the last transfer has passed.
+ * @param lcd - pointer to LCD object
+ * @retval true if transfers are pending, false if LCD is up to date (always false without LCD_ASYNC).
+ */
+bool lcd_is_busy(lcd_t *lcd)
 {
-  _lcd_cursor_set(y, x);
-  _lcd_send_data(location);
+#ifdef LCD_ASYNC
+  return (lcd->async.step != LCD_ASYNC_IDLE) || (ring_buffer_size(&lcd->queue) != 0) ||
+         ((uint32_t)(lcd_get_us() - lcd->async.timestamp) < lcd->async.wait_us);
+#else
+  (void)lcd;
+  return false;
+#endif
+}
+
+/**
+ * @brief Turn LCD backlight on (LCD_USE_PCF8574 mode, backlight is controlled by expander pin P3).
+ *        Without LCD_USE_PCF8574, this function does nothing.
+ * @param lcd - pointer to LCD object
+ */
+void lcd_backlight_on(lcd_t *lcd)
+{
+#ifdef LCD_USE_PCF8574
+  lcd->i2c.ctrl |= LCD_PCF8574_BACKLIGHT;
+  _lcd_i2c_put(lcd, lcd->i2c.ctrl);
+  _lcd_flush(lcd);
+#else
+  (void)lcd;
+#endif
+}
+
+/**
+ * @brief Turn LCD backlight off (LCD_USE_PCF8574 mode, backlight is controlled by expander pin P3).
+ *        Without LCD_USE_PCF8574, this function does nothing.
+ * @param lcd - pointer to LCD object
+ */
+void lcd_backlight_off(lcd_t *lcd)
+{
+#ifdef LCD_USE_PCF8574
+  lcd->i2c.ctrl &= ~LCD_PCF8574_BACKLIGHT;
+  _lcd_i2c_put(lcd, lcd->i2c.ctrl);
+  _lcd_flush(lcd);
+#else
+  (void)lcd;
+#endif
 }
 
 // Private functions
-void _lcd_send_command(uint8_t cmd)
+void _lcd_send_command(lcd_t *lcd, uint8_t cmd)
 {
+  _lcd_write(lcd, cmd, false); // Command mode
+
+  if (cmd < LCD_SETCGRAMADDR)
+  { // address commands are always followed by data, send them together
+    _lcd_flush(lcd);
+  }
+}
+
+void _lcd_send_data(lcd_t *lcd, uint8_t data)
+{
+  _lcd_write(lcd, data, true); // Data mode
+}
+
+// Send only high nibble of command (D4-D7), used in init before interface mode is set
+void _lcd_send_command_4_bit(lcd_t *lcd, uint8_t cmd)
+{
+  cmd <<= 4;
+
+#ifdef LCD_ASYNC
+  _lcd_queue_put(lcd, LCD_QUEUE_SINGLE | cmd);
+#else
   // Command mode
-  lcd_write_pin(LCD_RS_GPIO_Port, LCD_RS_Pin, false);
+  _lcd_set_rs(lcd, false);
 
-  // High nibble
-  _lcd_send_command_4_bit(cmd >> 4);
-  // Low nibble
-  _lcd_send_command_4_bit(cmd & 0x0F);
+  _lcd_write_bus(lcd, cmd);
+#endif
 }
 
-void _lcd_send_data(uint8_t data)
+void _lcd_write(lcd_t *lcd, uint8_t value, bool rs)
 {
-  // Data mode
-  lcd_write_pin(LCD_RS_GPIO_Port, LCD_RS_Pin, true);
+#ifdef LCD_ASYNC
+#ifdef LCD_8BIT_MODE
+  _lcd_queue_put(lcd, LCD_QUEUE_SINGLE | (rs ? LCD_QUEUE_RS : 0) | value);
+#else
+  _lcd_queue_put(lcd, (rs ? LCD_QUEUE_RS : 0) | value);
+#endif
+#else
+#ifdef LCD_USE_BUSY_FLAG
+  _lcd_wait_busy_flag(lcd);
+#endif
+  _lcd_set_rs(lcd, rs);
 
+#ifdef LCD_8BIT_MODE
+  _lcd_write_bus(lcd, value);
+#else
   // High nibble
-  _lcd_send_command_4_bit(data >> 4);
+  _lcd_write_bus(lcd, value);
   // Low nibble
-  _lcd_send_command_4_bit(data & 0x0F);
+  _lcd_write_bus(lcd, value << 4);
+#endif
+#endif
+}
+
+void _lcd_write_bus(lcd_t *lcd, uint8_t value)
+{
+#ifdef LCD_USE_PCF8574
+  // data is latched on falling edge of E
+  _lcd_i2c_put(lcd, lcd->i2c.ctrl | (value & 0xF0) | LCD_PCF8574_E);
+  _lcd_i2c_put(lcd, lcd->i2c.ctrl | (value & 0xF0));
+#else
+  _lcd_set_data_pins(lcd, value);
+  _lcd_enable_pulse(lcd);
+#endif
+}
+
+void _lcd_set_rs(lcd_t *lcd, bool rs)
+{
+#ifdef LCD_USE_PCF8574
+  if (rs)
+  {
+    lcd->i2c.ctrl |= LCD_PCF8574_RS;
+  }
+  else
+  {
+    lcd->i2c.ctrl &= ~LCD_PCF8574_RS;
+  }
+#else
+  lcd_write_pin(lcd->bus->rs.port, lcd->bus->rs.pin, rs);
+#endif
+}
+
+// Send all collected transfers (LCD_USE_PCF8574 mode), otherwise transfers are already sent
+void _lcd_flush(lcd_t *lcd)
+{
+#ifdef LCD_USE_PCF8574
+  if (lcd->i2c.len)
+  {
+    lcd_i2c_write(lcd->i2c_address, lcd->i2c.buff, lcd->i2c.len);
+    lcd->i2c.len = 0;
+  }
+#else
+  (void)lcd;
+#endif
+}
+
+#ifdef LCD_USE_PCF8574
+void _lcd_i2c_put(lcd_t *lcd, uint8_t data)
+{
+  if (lcd->i2c.len >= sizeof(lcd->i2c.buff))
+  {
+    _lcd_flush(lcd);
+  }
+  lcd->i2c.buff[lcd->i2c.len++] = data;
 }
+#endif
 
-void _lcd_send_command_4_bit(uint8_t cmd)
+// value bits are data pins D7-D0, only D7-D4 (high nibble) are used in 4-bit mode
+void _lcd_set_data_pins(lcd_t *lcd, uint8_t value)
 {
+#ifdef LCD_USE_PORT_WRITE
+  lcd_write_data_pins(lcd->bus->d[7].port, value);
+#else
+  uint8_t i;
+
   // Set output port
-  lcd_write_pin(LCD_D7_GPIO_Port, LCD_D7_Pin, (bool)(cmd & 0x08));
-  lcd_write_pin(LCD_D6_GPIO_Port, LCD_D6_Pin, (bool)(cmd & 0x04));
-  lcd_write_pin(LCD_D5_GPIO_Port, LCD_D5_Pin, (bool)(cmd & 0x02));
-  lcd_write_pin(LCD_D4_GPIO_Port, LCD_D4_Pin, (bool)(cmd & 0x01));
+  for (i = LCD_FIRST_DATA_PIN; i < 8; i++)
+  {
+    lcd_write_pin(lcd->bus->d[i].port, lcd->bus->d[i].pin, (bool)(value & (1 << i)));
+  }
+#endif
+}
 
-  _lcd_enable_pulse();
+void _lcd_delay_us(lcd_t *lcd, uint32_t us)
+{
+#ifdef LCD_ASYNC
+  while (us > LCD_QUEUE_DELAY_MAX_US)
+  {
+    _lcd_queue_put(lcd, LCD_QUEUE_DELAY | LCD_QUEUE_DELAY_MAX_US);
+    us -= LCD_QUEUE_DELAY_MAX_US;
+  }
+  _lcd_queue_put(lcd, LCD_QUEUE_DELAY | us);
+#else
+  _lcd_flush(lcd);
+  lcd_delay_us(us);
+#endif
 }
 
-void _lcd_cursor_set(uint8_t row, uint8_t col)
+void _lcd_delay_ms(lcd_t *lcd, uint32_t ms)
 {
-  uint8_t row_offsets[] = {0x00, 0x40, 0x14, 0x54};
+#ifdef LCD_ASYNC
+  _lcd_delay_us(lcd, ms * 1000);
+#else
+  _lcd_flush(lcd);
+  lcd_delay_ms(ms);
+#endif
+}
+
+void _lcd_wait_exec(lcd_t *lcd, uint32_t us)
+{
+#ifdef LCD_USE_BUSY_FLAG
+  if (lcd->busy_flag_valid)
+  { // LCD readiness is checked with busy flag before next transfer
+    return;
+  }
+#endif
+  _lcd_delay_us(lcd, us);
+}
+
+#ifdef LCD_USE_BUSY_FLAG
+void _lcd_wait_busy_flag(lcd_t *lcd)
+{
+  uint32_t elapsed_us = 0;
+  bool busy;
+
+  if (!lcd->busy_flag_valid)
+  {
+    return;
+  }
+
+  _lcd_set_data_pins_input(lcd, true);
+  lcd_write_pin(lcd->bus->rs.port, lcd->bus->rs.pin, false); // instruction register
+  lcd_write_pin(lcd->bus->rw.port, lcd->bus->rw.pin, true);  // read mode
+  do
+  {
+    // High nibble (or whole byte in 8-bit mode): D7 is busy flag
+    lcd_write_pin(lcd->e.port, lcd->e.pin, true);
+    lcd_delay_us(LCD_ENABLE_PULSE_US);
+    busy = lcd_read_pin(lcd->bus->d[7].port, lcd->bus->d[7].pin);
+    lcd_write_pin(lcd->e.port, lcd->e.pin, false);
+    lcd_delay_us(LCD_ENABLE_PULSE_US);
+    elapsed_us += 2 * LCD_ENABLE_PULSE_US; // at least, lcd_delay_us() is not precise
+
+#ifndef LCD_8BIT_MODE
+    // Low nibble (address counter) is not used, but must be read
+    lcd_write_pin(lcd->e.port, lcd->e.pin, true);
+    lcd_delay_us(LCD_ENABLE_PULSE_US);
+    lcd_write_pin(lcd->e.port, lcd->e.pin, false);
+    lcd_delay_us(LCD_ENABLE_PULSE_US);
+    elapsed_us += 2 * LCD_ENABLE_PULSE_US;
+#endif
+  } while (busy && (elapsed_us < LCD_BUSY_FLAG_TIMEOUT_US));
+  lcd_write_pin(lcd->bus->rw.port, lcd->bus->rw.pin, false); // write mode
+  _lcd_set_data_pins_input(lcd, false);
+
+  if (busy)
+  { // busy flag can't be read (R/W not connected?) - timeout already covers any command execution time,
+    // use fixed delays from now on
+    lcd->busy_flag_valid = false;
+  }
+}
+
+void _lcd_set_data_pins_input(lcd_t *lcd, bool input)
+{
+  uint8_t i;
+
+  for (i = LCD_FIRST_DATA_PIN; i < 8; i++)
+  {
+    lcd_set_pin_input(lcd->bus->d[i].port, lcd->bus->d[i].pin, input);
+  }
+}
+#endif
+
+#ifdef LCD_ASYNC
+void _lcd_queue_put(lcd_t *lcd, uint16_t entry)
+{
+  while (ring_buffer_put(&lcd->queue, &entry, 1) != RB_OK)
+  { // queue is full, make some space
+    lcd_task(lcd);
+  }
+}
+#endif
+
+void _lcd_print_float(lcd_t *lcd, uint8_t y, uint8_t x, float num, uint8_t decimals, uint8_t width, bool zero_pad,
+                      bool trim)
+{
+  char buf[LCD_NUM_BUFF_SIZE];
+  bool negative = (num < 0);
+  uint32_t int_part;
+  uint32_t frac_part;
+
+  if (num != num)
+  {
+    lcd_print_str(lcd, y, x, "nan");
+    return;
+  }
+  if (negative)
+  {
+    num = -num;
+  }
+  if (num >= 4294967296.0f)
+  { // 2^32, integer part doesn't fit in uint32_t
+    lcd_print_str(lcd, y, x, "ovf");
+    return;
+  }
+  if (decimals > LCD_NUM_MAX_DECIMALS)
+  {
+    decimals = LCD_NUM_MAX_DECIMALS;
+  }
+
+  int_part = (uint32_t)num;
+  frac_part = (uint32_t)((num - (float)int_part) * (float)_lcd_pow10[decimals] + 0.5f);
+  if (frac_part >= _lcd_pow10[decimals])
+  { // rounding carry, for example 9.96 with 1 decimal
+    frac_part -= _lcd_pow10[decimals];
+    int_part++;
+  }
+
+  if (trim)
+  { // remove trailing zeros
+    while ((decimals > 0) && ((frac_part % 10) == 0))
+    {
+      frac_part /= 10;
+      decimals--;
+    }
+  }
+  if ((int_part == 0) && (frac_part == 0))
+  { // don't print "-0"
+    negative = false;
+  }
+
+  _lcd_format_number(buf, negative, int_part, frac_part, decimals, width, zero_pad);
+  lcd_print_str(lcd, y, x, buf);
+}
+
+/*
+ * Format number "[-]int_part[.frac_part]" into buf (LCD_NUM_BUFF_SIZE), frac_part is printed with exactly
+ * decimals digits. Number is right-aligned to width characters, padded with spaces or zeros (after sign).
+ */
+void _lcd_format_number(char *buf, bool negative, uint32_t int_part, uint32_t frac_part, uint8_t decimals,
+                        uint8_t width, bool zero_pad)
+{
+  char digits[LCD_NUM_BUFF_SIZE];
+  char *end = &digits[sizeof(digits)];
+  char *ptr = end;
+  uint8_t len;
+  uint8_t i;
+
+  // digits are written from the end
+  for (i = 0; i < decimals; i++)
+  {
+    *--ptr = '0' + (frac_part % 10);
+    frac_part /= 10;
+  }
+  if (decimals)
+  {
+    *--ptr = '.';
+  }
+  do
+  {
+    *--ptr = '0' + (int_part % 10);
+    int_part /= 10;
+  } while (int_part);
+
+  len = (uint8_t)(end - ptr) + (negative ? 1 : 0);
+  if (width > (LCD_NUM_BUFF_SIZE - 1))
+  {
+    width = LCD_NUM_BUFF_SIZE - 1;
+  }
+
+  if (negative && zero_pad)
+  {
+    *buf++ = '-';
+  }
+  for (; len < width; len++)
+  {
+    *buf++ = zero_pad ? '0' : ' ';
+  }
+  if (negative && !zero_pad)
+  {
+    *buf++ = '-';
+  }
+  while (ptr < end)
+  {
+    *buf++ = *ptr++;
+  }
+  *buf = '\0';
+}
+
+void _lcd_marquee_draw(lcd_marquee_t *marquee)
+{
+  lcd_t *lcd = marquee->lcd;
+  const char *str = &marquee->str[marquee->offset];
+  uint8_t i;
+
+  _lcd_cursor_set(lcd, marquee->y, marquee->x);
+  for (i = 0; i < marquee->window_size; i++)
+  {
+    _lcd_write_char(lcd, str[i]);
+  }
+  _lcd_flush(lcd);
+}
+
+#ifdef LCD_USE_GLYPH_CACHE
+void _lcd_write_glyph(lcd_t *lcd, uint8_t id)
+{
+  uint8_t slot = _lcd_glyph_slot(lcd, id);
+
+  if (slot < LCD_CGRAM_SLOTS)
+  {
+    _lcd_write_char(lcd, slot);
+  }
+  else
+  { // unknown glyph
+    _lcd_write_char(lcd, '?');
+  }
+}
+
+// Get CGRAM slot of glyph, upload glyph if it is not resident. Returns LCD_CGRAM_SLOTS if glyph is not registered.
+uint8_t _lcd_glyph_slot(lcd_t *lcd, uint8_t id)
+{
+  uint8_t slot;
+  uint8_t i;
 
+  if ((id == 0) || (id > LCD_MAX_GLYPHS) || (lcd->glyphs.bitmaps[id - 1] == NULL))
+  {
+    return LCD_CGRAM_SLOTS;
+  }
+  lcd->glyphs.tick++;
+
+  for (slot = 0; slot < LCD_CGRAM_SLOTS; slot++)
+  {
+    if (lcd->glyphs.slot_glyph[slot] == id)
+    { // already resident, no upload
+      lcd->glyphs.slot_used[slot] = lcd->glyphs.tick;
+      return slot;
+    }
+  }
+
+  slot = _lcd_glyph_victim(lcd);
+  _lcd_send_command(lcd, LCD_SETCGRAMADDR | (slot << 3));
+  for (i = 0; i < 8; i++)
+  {
+    _lcd_send_data(lcd, lcd->glyphs.bitmaps[id - 1][i]);
+  }
+#ifndef LCD_USE_FRAMEBUFFER
+  // data is now written to CGRAM, restore DDRAM address (in framebuffer mode, address is set in lcd_refresh())
+  _lcd_set_ddram_address(lcd, lcd->current_y, lcd->current_x);
+#endif
+
+  lcd->glyphs.slot_glyph[slot] = id;
+  lcd->glyphs.slot_used[slot] = lcd->glyphs.tick;
+
+  return slot;
+}
+
+// Get CGRAM slot for new glyph: empty slot, otherwise least recently used one (not visible slots first)
+uint8_t _lcd_glyph_victim(lcd_t *lcd)
+{
+  uint8_t visible = 0; // bit mask of CGRAM slots shown on LCD
+  uint8_t victim = 0;
+  uint8_t slot;
+#ifdef LCD_USE_FRAMEBUFFER
+  uint8_t row, col;
+#endif
+
+  for (slot = 0; slot < LCD_CGRAM_SLOTS; slot++)
+  {
+    if (lcd->glyphs.slot_glyph[slot] == 0)
+    {
+      return slot;
+    }
+  }
+
+#ifdef LCD_USE_FRAMEBUFFER
+  for (row = 0; row < lcd->rows; row++)
+  {
+    for (col = 0; col < lcd->cols; col++)
+    { // character codes 0 - 7 (and aliases 8 - 15) are CGRAM slots
+      if (lcd->fb[row][col] < 16)
+      {
+        visible |= (1 << (lcd->fb[row][col] & 0x07));
+      }
+      if (lcd->screen[row][col] < 16)
+      {
+        visible |= (1 << (lcd->screen[row][col] & 0x07));
+      }
+    }
+  }
+#endif
+
+  for (slot = 1; slot < LCD_CGRAM_SLOTS; slot++)
+  {
+    bool slot_visible = (visible >> slot) & 0x01;
+    bool victim_visible = (visible >> victim) & 0x01;
+
+    if ((!slot_visible && victim_visible) ||
+        ((slot_visible == victim_visible) && (lcd->glyphs.slot_used[slot] < lcd->glyphs.slot_used[victim])))
+    {
+      victim = slot;
+    }
+  }
+  return victim;
+}
+#endif
+
+void _lcd_cursor_set(lcd_t *lcd, uint8_t row, uint8_t col)
+{
   // Go to beginning
-  if (row >= _lcd_options.rows)
+  if (row >= lcd->rows)
   {
     row = 0;
   }
 
   // Set current column and row
-  _lcd_options.current_x = col;
-  _lcd_options.current_y = row;
+  lcd->current_x = col;
+  lcd->current_y = row;
 
-  // Set location address
-  _lcd_send_command(LCD_SETDDRAMADDR | (col + row_offsets[row]));
+#ifndef LCD_USE_FRAMEBUFFER
+  // Set location address (in framebuffer mode, address is set in lcd_refresh())
+  _lcd_set_ddram_address(lcd, row, col);
+#endif
 }
 
-void _lcd_init_pins(void)
+void _lcd_set_ddram_address(lcd_t *lcd, uint8_t row, uint8_t col)
 {
-  // set GPIO initial state
-  lcd_write_pin(LCD_E_GPIO_Port, LCD_E_Pin, false);
-  lcd_write_pin(LCD_RS_GPIO_Port, LCD_RS_Pin, false);
+  uint8_t row_offsets[] = {0x00, 0x40, 0x14, 0x54};
 
-  lcd_write_pin(LCD_D4_GPIO_Port, LCD_D4_Pin, false);
-  lcd_write_pin(LCD_D5_GPIO_Port, LCD_D5_Pin, false);
-  lcd_write_pin(LCD_D6_GPIO_Port, LCD_D6_Pin, false);
-  lcd_write_pin(LCD_D7_GPIO_Port, LCD_D7_Pin, false);
+  _lcd_send_command(lcd, LCD_SETDDRAMADDR | (col + row_offsets[row]));
 }
 
-void _lcd_enable_pulse(void)
+void _lcd_write_char(lcd_t *lcd, uint8_t data)
 {
-  lcd_write_pin(LCD_E_GPIO_Port, LCD_E_Pin, true);
-  lcd_delay_us(2);
+#ifdef LCD_USE_FRAMEBUFFER
+  if ((lcd->current_y < lcd->rows) && (lcd->current_x < lcd->cols))
+  { // characters outside of LCD area are discarded
+    lcd->fb[lcd->current_y][lcd->current_x] = data;
+  }
+#else
+  _lcd_send_data(lcd, data);
+#endif
+  lcd->current_x++;
+}
 
-  lcd_write_pin(LCD_E_GPIO_Port, LCD_E_Pin, false);
-  lcd_delay_us(100);
+void _lcd_init_pins(lcd_t *lcd)
+{
+  // set GPIO initial state
+  lcd_write_pin(lcd->e.port, lcd->e.pin, false);
+  lcd_write_pin(lcd->bus->rs.port, lcd->bus->rs.pin, false);
+
+  _lcd_set_data_pins(lcd, 0);
+}
+
+void _lcd_enable_pulse(lcd_t *lcd)
+{
+  lcd_write_pin(lcd->e.port, lcd->e.pin, true);
+  lcd_delay_us(LCD_ENABLE_PULSE_US);
+
+  lcd_write_pin(lcd->e.port, lcd->e.pin, false);
+#ifdef LCD_USE_BUSY_FLAG
+  if (lcd->busy_flag_valid)
+  { // LCD readiness is checked with busy flag before next transfer
+    lcd_delay_us(LCD_ENABLE_PULSE_US);
+    return;
+  }
+#endif
+  lcd_delay_us(LCD_EXEC_TIME_US);
 }
@@ -3,11 +3,11 @@
  * File Name          : lcd.h
  * Description        : This file provides code for the configuration
  *                      of HD44780 based LCD
- * @date    13-Feb-2021
+ * @date    16-Oct-2026
  * @author  Domen Jurkovic, Damogran Labs
  * @source  http://damogranlabs.com/
  *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
- * @version v1.4
+ * @version v2.0
 */
 
 #ifndef __LCD_H
@@ -16,24 +16,178 @@
 #include <stdint.h>
 #include <stdbool.h>
 
-void lcd_init(uint8_t rows, uint8_t cols);
-void lcd_print_str(uint8_t y, uint8_t x, char *str);
-void lcd_print_str_window(uint8_t y, uint8_t x, uint8_t window_size, uint16_t speed_ms, char *str);
-void lcd_print_int(uint8_t y, uint8_t x, int32_t num);
-void lcd_print_float(uint8_t y, uint8_t x, float num, uint8_t precision);
-
-void lcd_display_on(void);
-void lcd_display_off(void);
-void lcd_clear(void);
-void lcd_clear_area(uint8_t y, uint8_t x_start, uint8_t x_end);
-void lcd_blink_on(void);
-void lcd_blink_off(void);
-void lcd_cursor_on(void);
-void lcd_cursor_off(void);
-void lcd_scroll_left(void);
-void lcd_scroll_right(void);
-
-void lcd_create_char(uint8_t location, uint8_t *data);
-void lcd_put_char(uint8_t y, uint8_t x, uint8_t location);
+#include "lcd_user.h"
+
+#if defined(LCD_USE_PCF8574) && (defined(LCD_8BIT_MODE) || defined(LCD_ASYNC) || defined(LCD_USE_BUSY_FLAG))
+#error "LCD_USE_PCF8574 can't be used with LCD_8BIT_MODE, LCD_ASYNC or LCD_USE_BUSY_FLAG"
+#endif
+
+#ifdef LCD_ASYNC
+#include "ring_buffer.h"
+// busy flag polling is blocking, asynchronous mode uses fixed delays
+#undef LCD_USE_BUSY_FLAG
+#endif
+
+#define LCD_GLYPH_ESC 0x1B // in strings, next character is glyph ID (LCD_USE_GLYPH_CACHE), for example "\x1B\x01"
+
+typedef struct
+{
+  LCD_GPIO_PORT_TYPE *port;
+  LCD_GPIO_PIN_TYPE pin;
+} lcd_pin_t;
+
+/*
+ * LCD bus: data, RS and R/W pins. Several LCDs can be connected to the same bus, each with its own E pin
+ * (LCD ignores bus while its E pin is low).
+ */
+typedef struct
+{
+  lcd_pin_t d[8]; // D0-D7, D0-D3 are used only in LCD_8BIT_MODE
+  lcd_pin_t rs;
+  lcd_pin_t rw; // used only with LCD_USE_BUSY_FLAG, otherwise LCD R/W pin must be tied to GND
+#ifdef LCD_ASYNC
+  struct lcd_s *owner; // LCD in the middle of transfer (E pulses), NULL if bus is free
+#endif
+} lcd_bus_t;
+
+#ifdef LCD_ASYNC
+typedef enum
+{
+  LCD_ASYNC_IDLE,       // next queue entry can be processed
+  LCD_ASYNC_HIGH_PULSE, // E is high for high nibble (or single bus write)
+  LCD_ASYNC_LOW_NIBBLE, // low nibble can be set
+  LCD_ASYNC_LOW_PULSE   // E is high for low nibble
+} lcd_async_step_t;
+
+typedef struct
+{
+  lcd_async_step_t step;
+  uint16_t entry;     // queue entry currently in transfer
+  uint32_t timestamp; // lcd_get_us() timestamp of the last step
+  uint32_t wait_us;   // time that must pass (since timestamp) before next step
+} lcd_async_t;
+#endif
+
+#ifdef LCD_USE_PCF8574
+typedef struct
+{
+  uint8_t buff[LCD_PCF8574_BUFFER_SIZE]; // expander bytes waiting to be sent
+  uint16_t len;
+  uint8_t ctrl; // RS and backlight pin states
+} lcd_i2c_t;
+#endif
+
+#ifdef LCD_USE_GLYPH_CACHE
+#define LCD_CGRAM_SLOTS 8
+
+typedef struct
+{
+  const uint8_t *bitmaps[LCD_MAX_GLYPHS]; // registered glyphs, index = glyph ID - 1
+  uint8_t slot_glyph[LCD_CGRAM_SLOTS];    // glyph ID in CGRAM slot, 0 = empty
+  uint32_t slot_used[LCD_CGRAM_SLOTS];    // usage tick of the slot, for LRU replacement
+  uint32_t tick;
+} lcd_glyph_cache_t;
+#endif
+
+/*
+ * LCD object. User sets connection (bus and E pin, or I2C address), all other members are set by lcd_init().
+ */
+typedef struct lcd_s
+{
+  lcd_bus_t *bus; // data, RS and R/W pins, can be shared with other LCDs (not used with LCD_USE_PCF8574)
+  lcd_pin_t e;    // E pin, each LCD has its own
+#ifdef LCD_USE_PCF8574
+  uint8_t i2c_address; // 7-bit I2C address of PCF8574 backpack, 0 = LCD_PCF8574_ADDRESS
+#endif
+
+  uint8_t display_ctrl;
+  uint8_t display_function;
+  uint8_t display_mode;
+  uint8_t rows;
+  uint8_t cols;
+  uint8_t current_x;
+  uint8_t current_y;
+
+#ifdef LCD_USE_FRAMEBUFFER
+  uint8_t fb[LCD_MAX_ROWS][LCD_MAX_COLS];     // characters to be displayed
+  uint8_t screen[LCD_MAX_ROWS][LCD_MAX_COLS]; // characters currently displayed on LCD
+#endif
+#ifdef LCD_ASYNC
+  rb_att_t queue;
+  uint16_t queue_buff[LCD_ASYNC_QUEUE_SIZE];
+  lcd_async_t async;
+#endif
+#ifdef LCD_USE_PCF8574
+  lcd_i2c_t i2c;
+#endif
+#ifdef LCD_USE_GLYPH_CACHE
+  lcd_glyph_cache_t glyphs;
+#endif
+#ifdef LCD_USE_BUSY_FLAG
+  bool busy_flag_valid; // false if busy flag polling timed out, fixed delays are used instead
+#endif
+} lcd_t;
+
+typedef enum
+{
+  LCD_MARQUEE_LOOP,     // after the end of string is shown, scrolling starts again from the beginning
+  LCD_MARQUEE_PING_PONG // after the end of string is shown, string is scrolled back to the beginning
+} lcd_marquee_mode_t;
+
+typedef struct
+{
+  lcd_t *lcd;
+  const char *str;
+  uint8_t y;
+  uint8_t x;
+  uint8_t window_size;
+  uint16_t speed_ms;
+  lcd_marquee_mode_t mode;
+
+  uint16_t length;    // string length
+  uint16_t offset;    // index of the first shown character
+  bool reverse;       // scrolling back to the beginning (ping-pong mode)
+  uint32_t timestamp; // time of the last scroll step
+  uint32_t wait_ms;   // time until next scroll step
+} lcd_marquee_t;
+
+void lcd_init(lcd_t *lcd, uint8_t rows, uint8_t cols);
+void lcd_print_str(lcd_t *lcd, uint8_t y, uint8_t x, char *str);
+void lcd_print_str_window(lcd_t *lcd, uint8_t y, uint8_t x, uint8_t window_size, uint16_t speed_ms, char *str);
+bool lcd_marquee_start(lcd_t *lcd, lcd_marquee_t *marquee, uint8_t y, uint8_t x, uint8_t window_size,
+                       uint16_t speed_ms, const char *str, lcd_marquee_mode_t mode);
+void lcd_marquee_stop(lcd_marquee_t *marquee);
+void lcd_marquee_handle(void);
+void lcd_print_int(lcd_t *lcd, uint8_t y, uint8_t x, int32_t num);
+void lcd_print_float(lcd_t *lcd, uint8_t y, uint8_t x, float num, uint8_t precision);
+void lcd_print_int_width(lcd_t *lcd, uint8_t y, uint8_t x, int32_t num, uint8_t width, bool zero_pad);
+void lcd_print_fixed(lcd_t *lcd, uint8_t y, uint8_t x, int32_t num, uint8_t decimals, uint8_t width, bool zero_pad);
+void lcd_print_float_width(lcd_t *lcd, uint8_t y, uint8_t x, float num, uint8_t decimals, uint8_t width,
+                           bool zero_pad);
+
+void lcd_display_on(lcd_t *lcd);
+void lcd_display_off(lcd_t *lcd);
+void lcd_clear(lcd_t *lcd);
+void lcd_clear_area(lcd_t *lcd, uint8_t y, uint8_t x_start, uint8_t x_end);
+void lcd_blink_on(lcd_t *lcd);
+void lcd_blink_off(lcd_t *lcd);
+void lcd_cursor_on(lcd_t *lcd);
+void lcd_cursor_off(lcd_t *lcd);
+void lcd_scroll_left(lcd_t *lcd);
+void lcd_scroll_right(lcd_t *lcd);
+
+void lcd_create_char(lcd_t *lcd, uint8_t location, uint8_t *data);
+void lcd_put_char(lcd_t *lcd, uint8_t y, uint8_t x, uint8_t location);
+void lcd_put_chars(lcd_t *lcd, uint8_t y, uint8_t x, const uint8_t *data, uint8_t len);
+bool lcd_glyph_register(lcd_t *lcd, uint8_t id, const uint8_t *bitmap);
+void lcd_put_glyph(lcd_t *lcd, uint8_t y, uint8_t x, uint8_t id);
+
+void lcd_refresh(lcd_t *lcd);
+
+void lcd_task(lcd_t *lcd);
+bool lcd_is_busy(lcd_t *lcd);
+
+void lcd_backlight_on(lcd_t *lcd);
+void lcd_backlight_off(lcd_t *lcd);
 
 #endif /* __LCD_H */
@@ -0,0 +1,347 @@
+/**
+ ******************************************************************************
+ * File Name          : lcd_graph.c
+ * Description        : This file provides bar graphs and big digits rendering
+ *                      for HD44780 based LCD
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+
+ Bar graphs (with sub-character resolution) and 2 rows tall big digits, drawn with LCD custom characters.
+ Only characters that changed since the previous draw are sent to LCD, so values can be updated often.
+
+ 1. Init LCD library (lcd_init()), then upload custom characters for graphs. LCD has only 8 custom characters,
+ so horizontal bars and big digits can be used together, vertical bars need all custom characters:
+ lcd_graph_load_glyphs(&lcd, LCD_GRAPH_GLYPHS_HBAR_DIGITS);
+ NOTE: this overwrites characters created with lcd_create_char().
+
+ 2. Bar graphs:
+ lcd_bar_t speed_bar;
+ lcd_bar_init(&lcd, &speed_bar, 1, 0, 16, LCD_BAR_HORIZONTAL); // row 1, 16 characters = 80 steps
+ lcd_bar_draw(&speed_bar, speed, MAX_SPEED);
+
+ 3. Big digits (3 characters wide, 2 rows tall, right-aligned):
+ lcd_big_num_t rpm;
+ lcd_big_num_init(&lcd, &rpm, 0, 0, 4); // rows 0-1, 4 digits
+ lcd_big_num_draw(&rpm, 1234);
+ */
+
+// Includes -------------------------------------
+#include <string.h>
+
+#include "lcd_graph.h"
+
+// private functions
+uint8_t _lcd_graph_bar_char(uint32_t *px, uint8_t px_per_char);
+void _lcd_graph_update(lcd_t *lcd, uint8_t *cells, const uint8_t *chars, uint8_t y, uint8_t x, uint8_t len,
+                       bool force);
+
+// Character codes
+#define LCD_GRAPH_EMPTY ' '  // empty cell
+#define LCD_GRAPH_FULL 0xFF  // all pixels on (LCD ROM character)
+#define LCD_GRAPH_HBAR_1 0   // custom characters 0 - 3: 1 - 4 pixel columns (from left)
+#define LCD_GRAPH_VBAR_1 0   // custom characters 0 - 6: 1 - 7 pixel rows (from bottom)
+#define LCD_GRAPH_DIGIT_T 4  // big digit part: top stroke
+#define LCD_GRAPH_DIGIT_B 5  // big digit part: bottom stroke
+#define LCD_GRAPH_DIGIT_X 6  // big digit part: top and bottom stroke
+
+#define LCD_GRAPH_CHAR_W 5 // character width in pixels
+#define LCD_GRAPH_CHAR_H 8 // character height in pixels
+
+// Big digits: 3 characters per row. F = full, T/B/X = strokes (see above)
+static const char *_lcd_big_digits[10][2] = {
+    {"FTF", "FBF"}, // 0
+    {"TF ", "BFB"}, // 1
+    {"XXF", "FBB"}, // 2
+    {"XXF", "BBF"}, // 3
+    {"FBF", "  F"}, // 4
+    {"FXX", "BBF"}, // 5
+    {"FXX", "FBF"}, // 6
+    {"TTF", "  F"}, // 7
+    {"FXF", "FBF"}, // 8
+    {"FXF", "BBF"}  // 9
+};
+
+/**
+ * @brief  Upload custom characters for bar graphs and big digits to LCD.
+ * @param  lcd - pointer to LCD object
+ * @param  glyphs - LCD_GRAPH_GLYPHS_HBAR_DIGITS (horizontal bars and big digits) or
+ *                  LCD_GRAPH_GLYPHS_VBAR (vertical bars)
+ * @note   All bars and big numbers should be redrawn (init again) after character set is changed.
+ */
+void lcd_graph_load_glyphs(lcd_t *lcd, lcd_graph_glyphs_t glyphs)
+{
+  uint8_t data[LCD_GRAPH_CHAR_H];
+  uint8_t i, row;
+
+  if (glyphs == LCD_GRAPH_GLYPHS_VBAR)
+  {
+    for (i = 0; i < 7; i++)
+    { // i + 1 pixel rows from bottom
+      for (row = 0; row < LCD_GRAPH_CHAR_H; row++)
+      {
+        data[row] = (row >= (LCD_GRAPH_CHAR_H - 1 - i)) ? 0x1F : 0x00;
+      }
+      lcd_create_char(lcd, LCD_GRAPH_VBAR_1 + i, data);
+    }
+  }
+  else
+  {
+    for (i = 0; i < 4; i++)
+    { // i + 1 pixel columns from left
+      for (row = 0; row < LCD_GRAPH_CHAR_H; row++)
+      {
+        data[row] = (0x1F << (4 - i)) & 0x1F;
+      }
+      lcd_create_char(lcd, LCD_GRAPH_HBAR_1 + i, data);
+    }
+
+    for (row = 0; row < LCD_GRAPH_CHAR_H; row++)
+    { // strokes are 2 pixel rows thick
+      data[row] = (row < 2) ? 0x1F : 0x00;
+    }
+    lcd_create_char(lcd, LCD_GRAPH_DIGIT_T, data);
+    for (row = 0; row < LCD_GRAPH_CHAR_H; row++)
+    {
+      data[row] = (row >= (LCD_GRAPH_CHAR_H - 2)) ? 0x1F : 0x00;
+    }
+    lcd_create_char(lcd, LCD_GRAPH_DIGIT_B, data);
+    for (row = 0; row < LCD_GRAPH_CHAR_H; row++)
+    {
+      data[row] = ((row < 2) || (row >= (LCD_GRAPH_CHAR_H - 2))) ? 0x1F : 0x00;
+    }
+    lcd_create_char(lcd, LCD_GRAPH_DIGIT_X, data);
+  }
+}
+
+/**
+ * @brief  Init bar graph object. Bar is drawn on first lcd_bar_draw() call.
+ * @param  lcd - pointer to LCD object, where bar is drawn
+ * @param  bar - pointer to bar object
+ * @param  y - row (for vertical bar: bottom row)
+ * @param  x - column
+ * @param  length - bar length in characters (up to LCD_GRAPH_MAX_LEN), limited to LCD size
+ *                  (0 - nothing is drawn - if bar starts outside of LCD)
+ * @param  dir - LCD_BAR_HORIZONTAL (needs LCD_GRAPH_GLYPHS_HBAR_DIGITS) or
+ *               LCD_BAR_VERTICAL (needs LCD_GRAPH_GLYPHS_VBAR)
+ */
+void lcd_bar_init(lcd_t *lcd, lcd_bar_t *bar, uint8_t y, uint8_t x, uint8_t length, lcd_bar_dir_t dir)
+{
+  if (length > LCD_GRAPH_MAX_LEN)
+  {
+    length = LCD_GRAPH_MAX_LEN;
+  }
+  if ((y >= lcd->rows) || (x >= lcd->cols))
+  { // outside of LCD
+    length = 0;
+  }
+  else if ((dir == LCD_BAR_VERTICAL) && (length > (y + 1)))
+  { // vertical bar grows up from row y, up to row 0
+    length = y + 1;
+  }
+  else if ((dir == LCD_BAR_HORIZONTAL) && (length > (lcd->cols - x)))
+  { // horizontal bar ends in last column
+    length = lcd->cols - x;
+  }
+  bar->lcd = lcd;
+  bar->y = y;
+  bar->x = x;
+  bar->length = length;
+  bar->dir = dir;
+  bar->drawn = false;
+}
+
+/**
+ * @brief  Draw bar graph. Only characters that changed since previous draw are sent to LCD.
+ *         Resolution is 5 steps per character (horizontal) or 8 steps per character (vertical).
+ * @param  bar - pointer to bar object
+ * @param  value - bar value, 0 - max
+ * @param  max - value of full bar (> 0)
+ */
+void lcd_bar_draw(lcd_bar_t *bar, uint16_t value, uint16_t max)
+{
+  uint8_t px_per_char = (bar->dir == LCD_BAR_HORIZONTAL) ? LCD_GRAPH_CHAR_W : LCD_GRAPH_CHAR_H;
+  uint32_t total_px = (uint32_t)bar->length * px_per_char;
+  uint8_t chars[LCD_GRAPH_MAX_LEN];
+  uint32_t px;
+  uint8_t i;
+
+  if ((max == 0) || (value >= max))
+  {
+    px = total_px;
+  }
+  else
+  { // rounded to nearest pixel
+    px = ((uint32_t)value * total_px + (max / 2)) / max;
+  }
+
+  for (i = 0; i < bar->length; i++)
+  {
+    chars[i] = _lcd_graph_bar_char(&px, px_per_char);
+  }
+
+  if (bar->dir == LCD_BAR_HORIZONTAL)
+  { // changed characters in one row: one cursor set per run
+    _lcd_graph_update(bar->lcd, bar->cells, chars, bar->y, bar->x, bar->length, !bar->drawn);
+  }
+  else
+  { // one character per row
+    for (i = 0; i < bar->length; i++)
+    {
+      _lcd_graph_update(bar->lcd, &bar->cells[i], &chars[i], bar->y - i, bar->x, 1, !bar->drawn);
+    }
+  }
+  bar->drawn = true;
+}
+
+/**
+ * @brief  Init big number object. Number is drawn on first lcd_big_num_draw() call.
+ * @param  lcd - pointer to LCD object, where number is drawn
+ * @param  num - pointer to big number object
+ * @param  y - top row (number takes rows y and y + 1)
+ * @param  x - column
+ * @param  digits - number of digits, number takes (4 * digits - 1) characters (up to LCD_GRAPH_MAX_LEN),
+ *                  limited to LCD size (0 - nothing is drawn - if both rows don't fit on LCD)
+ */
+void lcd_big_num_init(lcd_t *lcd, lcd_big_num_t *num, uint8_t y, uint8_t x, uint8_t digits)
+{
+  if (digits > ((LCD_GRAPH_MAX_LEN + 1) / 4))
+  {
+    digits = (LCD_GRAPH_MAX_LEN + 1) / 4;
+  }
+  if (((y + 1) >= lcd->rows) || (x >= lcd->cols))
+  { // outside of LCD
+    digits = 0;
+  }
+  else if (digits > ((lcd->cols - x + 1) / 4))
+  { // last digit ends in last column
+    digits = (lcd->cols - x + 1) / 4;
+  }
+  num->lcd = lcd;
+  num->y = y;
+  num->x = x;
+  num->digits = digits;
+  num->drawn = false;
+}
+
+/**
+ * @brief  Draw big number (right-aligned, without leading zeros). Needs LCD_GRAPH_GLYPHS_HBAR_DIGITS.
+ *         Only characters that changed since previous draw are sent to LCD.
+ * @param  num - pointer to big number object
+ * @param  value - number to display. If it has more digits than num->digits, all digits show 9.
+ */
+void lcd_big_num_draw(lcd_big_num_t *num, uint32_t value)
+{
+  uint8_t digit_values[LCD_GRAPH_MAX_LEN / 4 + 1];
+  uint8_t chars[LCD_GRAPH_MAX_LEN];
+  uint8_t first = num->digits - 1; // first digit that is not a leading zero
+  uint8_t width = (num->digits > 0) ? (num->digits * 4 - 1) : 0; // no space after the last digit
+  uint8_t d, row, col, x;
+  const char *pattern;
+
+  // split value into digits, from the last one
+  for (d = num->digits; d > 0; d--)
+  {
+    digit_values[d - 1] = value % 10;
+    value /= 10;
+  }
+  for (d = 0; d < num->digits; d++)
+  {
+    if (value != 0)
+    { // overflow
+      digit_values[d] = 9;
+    }
+    if ((digit_values[d] != 0) && (d < first))
+    {
+      first = d;
+    }
+  }
+
+  for (row = 0; row < 2; row++)
+  {
+    for (x = 0; x < width; x++)
+    {
+      d = x / 4;
+      col = x % 4;
+      pattern = (d < first) ? "   " : _lcd_big_digits[digit_values[d]][row];
+
+      switch ((col < 3) ? pattern[col] : ' ')
+      {
+      case 'F':
+        chars[x] = LCD_GRAPH_FULL;
+        break;
+      case 'T':
+        chars[x] = LCD_GRAPH_DIGIT_T;
+        break;
+      case 'B':
+        chars[x] = LCD_GRAPH_DIGIT_B;
+        break;
+      case 'X':
+        chars[x] = LCD_GRAPH_DIGIT_X;
+        break;
+      default:
+        chars[x] = LCD_GRAPH_EMPTY;
+        break;
+      }
+    }
+    _lcd_graph_update(num->lcd, num->cells[row], chars, num->y + row, num->x, width, !num->drawn);
+  }
+  num->drawn = true;
+}
+
+// Private functions
+// Character of the next bar cell, px: remaining pixels of bar
+uint8_t _lcd_graph_bar_char(uint32_t *px, uint8_t px_per_char)
+{
+  uint8_t cell_px;
+
+  if (*px >= px_per_char)
+  {
+    cell_px = px_per_char;
+    *px -= px_per_char;
+  }
+  else
+  {
+    cell_px = *px;
+    *px = 0;
+  }
+
+  if (cell_px == 0)
+  {
+    return LCD_GRAPH_EMPTY;
+  }
+  if (cell_px == px_per_char)
+  {
+    return LCD_GRAPH_FULL;
+  }
+  // LCD_GRAPH_HBAR_1 and LCD_GRAPH_VBAR_1 are both custom character 0
+  return LCD_GRAPH_HBAR_1 + cell_px - 1;
+}
+
+// Send characters that differ from displayed cells (all if force), adjacent changed characters of a row are sent
+// as one run after a single cursor set
+void _lcd_graph_update(lcd_t *lcd, uint8_t *cells, const uint8_t *chars, uint8_t y, uint8_t x, uint8_t len,
+                       bool force)
+{
+  uint8_t start = 0;
+  uint8_t end;
+
+  while (start < len)
+  {
+    if (!force && (cells[start] == chars[start]))
+    {
+      start++;
+      continue;
+    }
+    end = start + 1;
+    while ((end < len) && (force || (cells[end] != chars[end])))
+    {
+      end++;
+    }
+    lcd_put_chars(lcd, y, x + start, &chars[start], end - start);
+    memcpy(&cells[start], &chars[start], end - start);
+    start = end;
+  }
+}
@@ -0,0 +1,66 @@
+/**
+ ******************************************************************************
+ * File Name          : lcd_graph.h
+ * Description        : This file provides bar graphs and big digits rendering
+ *                      for HD44780 based LCD
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+*/
+
+#ifndef __LCD_GRAPH_H
+#define __LCD_GRAPH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "lcd.h"
+
+#define LCD_GRAPH_MAX_LEN 20 // maximum bar length or big number width (in characters)
+
+typedef enum
+{
+  LCD_GRAPH_GLYPHS_HBAR_DIGITS, // custom characters for horizontal bars and big digits
+  LCD_GRAPH_GLYPHS_VBAR         // custom characters for vertical bars
+} lcd_graph_glyphs_t;
+
+typedef enum
+{
+  LCD_BAR_HORIZONTAL, // bar grows from x to the right
+  LCD_BAR_VERTICAL    // bar grows from y (bottom row) up
+} lcd_bar_dir_t;
+
+typedef struct
+{
+  lcd_t *lcd;
+  uint8_t y;
+  uint8_t x;
+  uint8_t length; // number of characters
+  lcd_bar_dir_t dir;
+
+  uint8_t cells[LCD_GRAPH_MAX_LEN]; // characters currently displayed
+  bool drawn;                       // false until bar is drawn for the first time
+} lcd_bar_t;
+
+typedef struct
+{
+  lcd_t *lcd;
+  uint8_t y; // top row, big digits are 2 rows tall
+  uint8_t x;
+  uint8_t digits; // number of digits, each digit is 3 characters wide + 1 character space
+
+  uint8_t cells[2][LCD_GRAPH_MAX_LEN]; // characters currently displayed
+  bool drawn;                          // false until number is drawn for the first time
+} lcd_big_num_t;
+
+void lcd_graph_load_glyphs(lcd_t *lcd, lcd_graph_glyphs_t glyphs);
+
+void lcd_bar_init(lcd_t *lcd, lcd_bar_t *bar, uint8_t y, uint8_t x, uint8_t length, lcd_bar_dir_t dir);
+void lcd_bar_draw(lcd_bar_t *bar, uint16_t value, uint16_t max);
+
+void lcd_big_num_init(lcd_t *lcd, lcd_big_num_t *num, uint8_t y, uint8_t x, uint8_t digits);
+void lcd_big_num_draw(lcd_big_num_t *num, uint32_t value);
+
+#endif /* __LCD_GRAPH_H */
@@ -0,0 +1,282 @@
+/**
+ ******************************************************************************
+ * File Name          : lcd_term.c
+ * Description        : This file provides scrolling text terminal
+ *                      for HD44780 based LCD
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+
+ Log-style text terminal on top of the LCD library. Text is appended at the cursor, '\n' starts a new line and
+ '\r' returns to the beginning of current line, other characters are written to LCD as they are (custom
+ characters 1 - 7 can be printed). When LCD is full, text scrolls up. Last LCD_TERM_HISTORY lines
+ are kept, so user can scroll back. LCD has no vertical scroll, but only characters that differ from the shadow
+ buffer (characters currently in LCD) are sent - scrolling mostly similar lines is cheap.
+ Terminal uses the whole LCD, don't print to the same LCD with other functions.
+
+ 1. Init LCD library (lcd_init()), then terminal:
+ lcd_term_t term;
+ lcd_term_init(&lcd, &term, true); // true: wrap lines that are wider than LCD
+
+ 2. Print:
+ lcd_term_print(&term, "Boot OK\n");
+ lcd_term_print(&term, "Temp: 21.5 C\n");
+ lcd_term_print(&term, "Progress 10%\r"); // next print overwrites this line
+
+ 3. History and wide lines:
+ lcd_term_scroll(&term, 1);  // show one older line (negative: newer lines)
+ lcd_term_scroll(&term, -LCD_TERM_HISTORY); // back to the newest lines
+ Without wrap, lines up to LCD_TERM_LINE_LEN characters are kept and can be panned horizontally:
+ lcd_term_pan(&term, 10); // column 10 of virtual lines is shown in the first LCD column
+ On LCDs with 1 or 2 rows, whole virtual lines are written to LCD (DDRAM) and panning is done with LCD display shift
+ (lcd_scroll_left()/lcd_scroll_right()), without rewriting any characters. Display shift can't be used on 4 row
+ LCDs (rows 0 and 2 share the same DDRAM line), with LCD_USE_FRAMEBUFFER or with
+ LCD_GO_TO_NEW_LINE_IF_STRING_TOO_LONG - visible part of lines is redrawn instead.
+
+ NOTE: in LCD_USE_FRAMEBUFFER mode, call lcd_refresh() after terminal functions.
+ */
+
+// Includes -------------------------------------
+#include <string.h>
+
+#include "lcd_term.h"
+
+// private functions
+void _lcd_term_new_line(lcd_term_t *term);
+char *_lcd_term_line(lcd_term_t *term, uint8_t index);
+uint8_t _lcd_term_max_view(lcd_term_t *term);
+void _lcd_term_draw(lcd_term_t *term);
+
+/**
+ * @brief  Init terminal object and clear LCD.
+ * @param  lcd - pointer to initialized LCD object, terminal uses the whole LCD
+ * @param  term - pointer to terminal object
+ * @param  wrap - true to continue text on new line when LCD width is reached,
+ *                false to keep lines up to LCD_TERM_LINE_LEN characters (see lcd_term_pan())
+ */
+void lcd_term_init(lcd_t *lcd, lcd_term_t *term, bool wrap)
+{
+  term->lcd = lcd;
+  term->wrap = wrap;
+  term->rows = (lcd->rows < LCD_TERM_MAX_ROWS) ? lcd->rows : LCD_TERM_MAX_ROWS;
+
+#if defined(LCD_USE_FRAMEBUFFER) || defined(LCD_GO_TO_NEW_LINE_IF_STRING_TOO_LONG)
+  term->hw_pan = false;
+#else
+  // rows 0 and 2 (1 and 3) of 4 row LCD are parts of the same DDRAM line, display shift moves both
+  term->hw_pan = (lcd->rows <= 2);
+#endif
+  if (term->hw_pan)
+  {
+    term->width = LCD_TERM_LINE_LEN;
+  }
+  else
+  {
+    term->width = (lcd->cols < LCD_TERM_LINE_LEN) ? lcd->cols : LCD_TERM_LINE_LEN;
+  }
+
+  lcd_clear(lcd); // also resets display shift
+  memset(term->shown, ' ', sizeof(term->shown));
+  term->pan = 0;
+  lcd_term_clear(term);
+}
+
+/**
+ * @brief  Print string at terminal cursor and redraw changed characters.
+ *         '\n' starts new line (text scrolls up when LCD is full), '\r' moves cursor to the beginning of line.
+ *         If user scrolled back in history (lcd_term_scroll()), view stays on the same lines.
+ * @param  term - pointer to terminal object
+ * @param  str - string to print
+ */
+void lcd_term_print(lcd_term_t *term, const char *str)
+{
+  uint8_t max_col = term->wrap ? term->lcd->cols : LCD_TERM_LINE_LEN;
+  char *line;
+
+  if (max_col > LCD_TERM_LINE_LEN)
+  {
+    max_col = LCD_TERM_LINE_LEN;
+  }
+
+  while (*str)
+  {
+    if (*str == '\n')
+    {
+      _lcd_term_new_line(term);
+    }
+    else if (*str == '\r')
+    {
+      term->col = 0;
+    }
+    else
+    {
+      if ((term->col >= max_col) && term->wrap)
+      {
+        _lcd_term_new_line(term);
+      }
+      if (term->col < max_col)
+      { // without wrap, characters after LCD_TERM_LINE_LEN are discarded
+        line = _lcd_term_line(term, term->count - 1);
+        line[term->col++] = *str;
+      }
+    }
+    str++;
+  }
+  _lcd_term_draw(term);
+}
+
+/**
+ * @brief  Clear terminal history and LCD, cursor is moved to the top left corner.
+ * @param  term - pointer to terminal object
+ */
+void lcd_term_clear(lcd_term_t *term)
+{
+  memset(term->lines, ' ', sizeof(term->lines));
+  term->oldest = 0;
+  term->count = 1;
+  term->col = 0;
+  term->view = 0;
+  _lcd_term_draw(term);
+}
+
+/**
+ * @brief  Scroll terminal view through history.
+ * @param  term - pointer to terminal object
+ * @param  lines - number of lines to scroll back (older lines), negative to scroll forward (newer lines).
+ *                 View is limited to available history.
+ */
+void lcd_term_scroll(lcd_term_t *term, int8_t lines)
+{
+  int16_t view = (int16_t)term->view + lines;
+  uint8_t max_view = _lcd_term_max_view(term);
+
+  if (view < 0)
+  {
+    view = 0;
+  }
+  if (view > max_view)
+  {
+    view = max_view;
+  }
+  term->view = (uint8_t)view;
+  _lcd_term_draw(term);
+}
+
+/**
+ * @brief  Pan terminal view horizontally (lines wider than LCD, terminal without wrap).
+ * @param  term - pointer to terminal object
+ * @param  x - column of virtual lines shown in the first LCD column (0 - LCD_TERM_LINE_LEN - LCD width)
+ */
+void lcd_term_pan(lcd_term_t *term, uint8_t x)
+{
+  uint8_t max_pan = 0;
+
+  if (term->lcd->cols < LCD_TERM_LINE_LEN)
+  {
+    max_pan = LCD_TERM_LINE_LEN - term->lcd->cols;
+  }
+  if (x > max_pan)
+  {
+    x = max_pan;
+  }
+
+  if (term->hw_pan)
+  { // whole lines are already in DDRAM, only move display window
+    while (term->pan < x)
+    {
+      lcd_scroll_left(term->lcd);
+      term->pan++;
+    }
+    while (term->pan > x)
+    {
+      lcd_scroll_right(term->lcd);
+      term->pan--;
+    }
+  }
+  else
+  {
+    term->pan = x;
+    _lcd_term_draw(term);
+  }
+}
+
+// Private functions
+void _lcd_term_new_line(lcd_term_t *term)
+{
+  if (term->count < LCD_TERM_HISTORY)
+  {
+    term->count++;
+  }
+  else
+  { // history is full, drop the oldest line
+    term->oldest = (term->oldest + 1) % LCD_TERM_HISTORY;
+  }
+  memset(_lcd_term_line(term, term->count - 1), ' ', LCD_TERM_LINE_LEN);
+  term->col = 0;
+
+  if ((term->view > 0) && (term->view < _lcd_term_max_view(term)))
+  { // user is looking at older lines, keep them in view
+    term->view++;
+  }
+}
+
+// Get history line, index 0 is the oldest line
+char *_lcd_term_line(lcd_term_t *term, uint8_t index)
+{
+  return term->lines[(term->oldest + index) % LCD_TERM_HISTORY];
+}
+
+uint8_t _lcd_term_max_view(lcd_term_t *term)
+{
+  return (term->count > term->rows) ? (term->count - term->rows) : 0;
+}
+
+// Send characters that differ from shadow buffer, adjacent changed characters are sent as one run. Characters are
+// sent as they are (not as string with control characters), so each one takes exactly one LCD cell.
+void _lcd_term_draw(lcd_term_t *term)
+{
+  char run[LCD_TERM_LINE_LEN];
+  uint8_t first = 0; // history index of line in the first LCD row
+  uint8_t offset = term->hw_pan ? 0 : term->pan;
+  uint8_t row, col;
+  uint8_t start = 0;
+  uint8_t len;
+  char *line;
+  char c;
+
+  if (term->count > term->rows)
+  {
+    first = term->count - term->rows - term->view;
+  }
+
+  for (row = 0; row < term->rows; row++)
+  {
+    line = ((first + row) < term->count) ? _lcd_term_line(term, first + row) : NULL;
+    len = 0;
+
+    for (col = 0; col <= term->width; col++)
+    {
+      if (col < term->width)
+      {
+        c = ((line != NULL) && ((offset + col) < LCD_TERM_LINE_LEN)) ? line[offset + col] : ' ';
+        if (c != term->shown[row][col])
+        {
+          if (len == 0)
+          {
+            start = col;
+          }
+          run[len++] = c;
+          term->shown[row][col] = c;
+          continue;
+        }
+      }
+      if (len)
+      { // end of changed characters run (or end of row)
+        lcd_put_chars(term->lcd, row, start, (const uint8_t *)run, len);
+        len = 0;
+      }
+    }
+  }
+}
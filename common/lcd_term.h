@@ -0,0 +1,49 @@
+/**
+ ******************************************************************************
+ * File Name          : lcd_term.h
+ * Description        : This file provides scrolling text terminal
+ *                      for HD44780 based LCD
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+*/
+
+#ifndef __LCD_TERM_H
+#define __LCD_TERM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "lcd.h"
+
+#define LCD_TERM_MAX_ROWS 4  // maximum number of LCD rows used by terminal
+#define LCD_TERM_LINE_LEN 40 // virtual line width in characters (HD44780 DDRAM line length in 2-line mode)
+#define LCD_TERM_HISTORY 8   // number of lines kept in history (>= LCD rows)
+
+typedef struct
+{
+  lcd_t *lcd;
+  bool wrap;     // continue on new line when LCD width is reached, otherwise lines up to LCD_TERM_LINE_LEN are kept
+  bool hw_pan;   // horizontal panning with LCD display shift (whole virtual lines are written to DDRAM)
+  uint8_t rows;  // number of LCD rows used by terminal
+  uint8_t width; // characters per row in shadow buffer (LCD_TERM_LINE_LEN with hw_pan, otherwise LCD width)
+
+  char lines[LCD_TERM_HISTORY][LCD_TERM_LINE_LEN]; // line history ring, lines are padded with spaces
+  uint8_t oldest; // ring index of the oldest line
+  uint8_t count;  // number of lines in history, the last one is the current line
+  uint8_t col;    // cursor column in current line
+  uint8_t view;   // number of lines scrolled back from the newest line
+  uint8_t pan;    // horizontal pan, index of the first visible column
+
+  char shown[LCD_TERM_MAX_ROWS][LCD_TERM_LINE_LEN]; // characters currently in LCD (shadow buffer)
+} lcd_term_t;
+
+void lcd_term_init(lcd_t *lcd, lcd_term_t *term, bool wrap);
+void lcd_term_print(lcd_term_t *term, const char *str);
+void lcd_term_clear(lcd_term_t *term);
+void lcd_term_scroll(lcd_term_t *term, int8_t lines);
+void lcd_term_pan(lcd_term_t *term, uint8_t x);
+
+#endif /* __LCD_TERM_H */
@@ -3,9 +3,9 @@
  * File Name          : ring_buffer
  * Description        : This file provides code for the initialization
  *                      of circular (ring) buffer
- * @date    30-May-2020
+ * @date    16-Oct-2026
  * @author  Originally: Chris Karaplis, modified by Domen Jurkovic
- * @version v1.3
+ * @version v1.4
  *
  * Copyright (c) 2015, simplyembedded.org
  * Copyright (c) 2020, damogranlabs.com
@@ -48,10 +48,49 @@
  *
  *    3. Init ring buffer and check for error (for example, your error report function is called handle_error()):
  *        if(ring_buffer_init(&rx_buff, RX_BUFF_SIZE) != RB_OK) handle_error();
+ *       Call ring_buffer_deinit(&rx_buff) to free memory before buffer is initialized again.
+ *
+ *       Or, without heap usage, init ring buffer with user provided storage (can be placed in any RAM section):
+ *        uint8_t rx_storage[RX_BUFF_SIZE];
+ *        if(ring_buffer_init_static(&rx_buff, rx_storage, RX_BUFF_SIZE) != RB_OK) handle_error();
+ *
+ *       Or define (at file scope) initialized descriptor and its storage at once, instead of steps 1. and 3.:
+ *        RING_BUFFER_DEFINE(rx_buff, RX_BUFF_SIZE);
+ *
+ *       Buffers of multi-byte elements (records) are initialized with ring_buffer_init_elem(),
+ *       ring_buffer_init_static_elem() or RING_BUFFER_DEFINE_TYPED(). All "num" parameters and
+ *       return values are then in number of elements, records are never split:
+ *        RING_BUFFER_DEFINE_TYPED(samples, sensor_sample_t, 32);
+ *        ring_buffer_put(&samples, &sample, 1);
  *
  *    4. Put/get data to/from ring buffer:
  *        ring_buffer_put(&rx_buff, data, 20);
  *        ring_buffer_get(&rx_buff, data, 10);
+ *
+ *    5. Single producer/single consumer usage (for example, UART RX interrupt -> main loop):
+ *        ring_buffer_put() in interrupt and ring_buffer_get() in main loop can be called
+ *        without disabling interrupts, as long as there is only one producer and one consumer.
+ *        ring_buffer_init() and ring_buffer_wipe() must not run concurrently with put/get.
+ *        ring_buffer_flush() is consumer side (discards data by moving tail only).
+ *
+ *    6. Zero-copy access (for example, DMA or parser working directly in buffer memory):
+ *        rb_span_t span[2];
+ *        // writer: get free space, fill it, then publish written elements
+ *        if (ring_buffer_reserve(&rx_buff, span) >= 10) { dma_start(span[0].data, span[0].num); ... }
+ *        ring_buffer_commit(&rx_buff, received);
+ *        // reader: get stored data, process it, then release processed elements
+ *        ring_buffer_peek(&rx_buff, span);
+ *        ring_buffer_consume(&rx_buff, parsed);
+ *        Reserve/commit is producer side, peek/consume is consumer side (same rules as put/get).
+ *
+ *    7. Overwrite (flight recorder) mode, keeps the newest data:
+ *        ring_buffer_set_overwrite(&log_buff, true);
+ *        ring_buffer_put(&log_buff, data, 20); // oldest elements are discarded if buffer is full
+ *        NOTE: in this mode producer also moves tail, so put and get must not run concurrently.
+ *
+ *    8. Buffer sizing: uncomment RB_STATISTICS in ring_buffer.h, run application and check high-water mark:
+ *        rb_stats_t stats;
+ *        ring_buffer_get_stats(&rx_buff, &stats);
  */
 
 /* Includes ------------------------------------------------------------------*/
@@ -59,83 +98,196 @@
 
 #include <string.h>
 #include <stdlib.h>
+#include <stdatomic.h>
+
+// private functions
+static inline uint32_t _rb_count(rb_att_t *rbd, uint32_t head, uint32_t tail);
+static inline uint32_t _rb_offset(rb_att_t *rbd, uint32_t idx);
+static inline uint32_t _rb_advance(rb_att_t *rbd, uint32_t idx, uint32_t num);
+static inline void _rb_spans(rb_att_t *rbd, uint32_t idx, uint32_t num, rb_span_t span[2]);
+static void _rb_write(rb_att_t *rbd, uint32_t head, const void *data, uint32_t num);
+static void _rb_read(rb_att_t *rbd, uint32_t tail, void *data, uint32_t num);
+static inline void _rb_stats_in(rb_att_t *rbd, uint32_t head, uint32_t num);
+static inline void _rb_stats_out(rb_att_t *rbd, uint32_t num);
+static inline void _rb_stats_rejected(rb_att_t *rbd);
+static inline void _rb_stats_underflow(rb_att_t *rbd);
 
 /**
- * @brief Initialize a ring buffer
+ * @brief Initialize a ring buffer, allocate buffer memory on heap
  * @param *rbd - pointer to the ring buffer descriptor
- * @param size - ring buffer size in number of bytes
+ * @param size - ring buffer size in number of bytes (1 ... 0x7FFFFFFF)
  * @return RB_ERROR, RB_OK
+ * @note If RB_POWER_OF_TWO_SIZE is defined, size must be a power of two (1, 2, 4, ... 0x40000000).
  */
 rb_status_t ring_buffer_init(rb_att_t *rbd, uint32_t size)
 {
+  return ring_buffer_init_elem(rbd, size, sizeof(uint8_t));
+}
+
+/**
+ * @brief Initialize a ring buffer with user provided storage (no heap is used, storage is not cleared)
+ * @param *rbd - pointer to the ring buffer descriptor
+ * @param *storage - pointer to buffer memory of at least "size" bytes
+ * @param size - ring buffer size in number of bytes (1 ... 0x7FFFFFFF)
+ * @return RB_ERROR, RB_OK
+ * @note If RB_POWER_OF_TWO_SIZE is defined, size must be a power of two (1, 2, 4, ... 0x40000000).
+ */
+rb_status_t ring_buffer_init_static(rb_att_t *rbd, uint8_t *storage, uint32_t size)
+{
+  return ring_buffer_init_static_elem(rbd, storage, size, sizeof(uint8_t));
+}
+
+/**
+ * @brief Initialize a ring buffer of multi-byte elements, allocate buffer memory on heap
+ * @param *rbd - pointer to the ring buffer descriptor
+ * @param n_elem - ring buffer size in number of elements (1 ... 0x7FFFFFFF)
+ * @param s_elem - size of one element in bytes (n_elem * s_elem must fit in uint32_t)
+ * @return RB_ERROR, RB_OK
+ * @note If RB_POWER_OF_TWO_SIZE is defined, n_elem must be a power of two (1, 2, 4, ... 0x40000000).
+ */
+rb_status_t ring_buffer_init_elem(rb_att_t *rbd, uint32_t n_elem, uint32_t s_elem)
+{
+  uint8_t *buff;
+
+  if (rbd == NULL)
+  { // rbd must not be pointer to nowhere
+    return RB_ERROR;
+  }
   rbd->status = RB_ERROR;
 
-  if (rbd != NULL)
-  {                                            // rbd must not be pointer to nowhere
-    rbd->buff = calloc(size, sizeof(uint8_t)); // allocate memory of "size" bytes, set all values to 0.
-    //rbd->buff = malloc(size * sizeof(uint8_t)); // Use this instead of calloc() if you don't wish to set all values to 0 by default.
+  if (_RB_SIZE_VALID(n_elem, s_elem))
+  {
+    buff = malloc(n_elem * s_elem); // allocate memory of "n_elem * s_elem" bytes. Memory is not cleared, data is always written before it is read.
+    //buff = calloc(n_elem, s_elem); // Use this instead of malloc() if you wish to set all values to 0 by default.
 
-    if (rbd->buff != NULL)
+    if (buff != NULL)
     { // buff must not be pointer to nowhere
-      rbd->n_elem = size;
+      ring_buffer_init_static_elem(rbd, buff, n_elem, s_elem);
+      rbd->is_allocated = true;
+    }
+  }
 
-      // Initialize the ring buffer internal variables
-      rbd->head = 0;
-      rbd->tail = 0;
-      rbd->count = 0;
+  return rbd->status;
+}
 
-      rbd->status = RB_OK;
-    }
+/**
+ * @brief Initialize a ring buffer of multi-byte elements with user provided storage
+ *        (no heap is used, storage is not cleared)
+ * @param *rbd - pointer to the ring buffer descriptor
+ * @param *storage - pointer to buffer memory of at least "n_elem * s_elem" bytes
+ * @param n_elem - ring buffer size in number of elements (1 ... 0x7FFFFFFF)
+ * @param s_elem - size of one element in bytes (n_elem * s_elem must fit in uint32_t)
+ * @return RB_ERROR, RB_OK
+ * @note If RB_POWER_OF_TWO_SIZE is defined, n_elem must be a power of two (1, 2, 4, ... 0x40000000).
+ */
+rb_status_t ring_buffer_init_static_elem(rb_att_t *rbd, void *storage, uint32_t n_elem, uint32_t s_elem)
+{
+  if (rbd == NULL)
+  { // rbd must not be pointer to nowhere
+    return RB_ERROR;
+  }
+  rbd->status = RB_ERROR;
+
+  if ((storage != NULL) && _RB_SIZE_VALID(n_elem, s_elem))
+  {
+    rbd->buff = storage;
+    rbd->n_elem = n_elem;
+    rbd->s_elem = s_elem;
+    rbd->is_allocated = false;
+    rbd->overwrite = false;
+    rbd->dropped = 0;
+
+    // Initialize the ring buffer internal variables
+    atomic_store_explicit(&rbd->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&rbd->tail, 0, memory_order_relaxed);
+#ifdef RB_STATISTICS
+    ring_buffer_reset_stats(rbd); // high water mark starts at current size, so after head/tail
+#endif
+
+    rbd->status = RB_OK;
   }
 
   return rbd->status;
 }
 
+/**
+ * @brief Deinitialize a ring buffer and free buffer memory if it was allocated by ring_buffer_init().
+ *        User provided storage (ring_buffer_init_static(), RING_BUFFER_DEFINE()) is only detached.
+ * @param *rbd - pointer to the ring buffer descriptor
+ */
+void ring_buffer_deinit(rb_att_t *rbd)
+{
+  if (rbd == NULL)
+  {
+    return;
+  }
+
+  if (rbd->is_allocated)
+  {
+    free(rbd->buff);
+  }
+  rbd->buff = NULL;
+  rbd->n_elem = 0;
+  rbd->s_elem = 0;
+  rbd->is_allocated = false;
+
+  atomic_store_explicit(&rbd->head, 0, memory_order_relaxed);
+  atomic_store_explicit(&rbd->tail, 0, memory_order_relaxed);
+
+  rbd->status = RB_ERROR;
+}
+
 /**
  * @brief Add a number of elements to the ring buffer
  * @param *rbd - pointer to the ring buffer descriptor
- * @param data - the data to add
+ * @param data - the data to add (num * s_elem bytes)
  * @param num - number of elements to add
  * @return RB_NOT_ENOUGH_SPACE, RB_OK, RB_ERROR
+ * @note Producer side: only head is written, safe to call concurrently with ring_buffer_get().
  */
-rb_status_t ring_buffer_put(rb_att_t *rbd, uint8_t *data, uint32_t num)
+rb_status_t ring_buffer_put(rb_att_t *rbd, const void *data, uint32_t num)
 {
   rb_status_t status = RB_ERROR;
-  uint32_t num_to_end = 0; // number of elements to the last buffer element (including current one (head))
+  uint32_t head, tail;
+  uint32_t free_elem;
+  uint32_t drop;
 
-  if (rbd != NULL)
+  if (rbd == NULL)
   { // rbd must not be a pointer to nowhere
-    if (ring_buffer_free_elements(rbd) >= num)
-    { // is there enough space in buffer for num of data
-      if (rbd->head >= rbd->n_elem)
-      { // reset ring buffer head
-        rbd->head = 0;
-      }
-
-      num_to_end = rbd->n_elem - rbd->head; // that many data can be written into buffer, before reaching buffer last element
-      if (num_to_end < num)
-      {                                                             // if there is not enough space for "num" of data before reaching buffer last element
-        memcpy(&(rbd->buff[rbd->head]), data, num_to_end);          //write to buffer partial data
-        memcpy(rbd->buff, (data + num_to_end), (num - num_to_end)); //write to buffer rest of the data, starting with buffer[0]
-
-        rbd->head = num - num_to_end;  //head
-        rbd->count = rbd->count + num; // increment counter for num of data
-      }
-      else
-      {                                             // there is enough space before reaching buffer's last element
-        memcpy(&(rbd->buff[rbd->head]), data, num); //write to buffer all num of data in one piece
-
-        rbd->head = rbd->head + num;   // increment head
-        rbd->count = rbd->count + num; // increment counter for num of data
-      }
-
-      status = RB_OK;
-    }
-    else
-    { // there is not enough space in buffer for num of data
-      status = RB_NOT_ENOUGH_SPACE;
+    return RB_ERROR;
+  }
+
+  head = atomic_load_explicit(&rbd->head, memory_order_relaxed); // head is written only by this (producer) side
+  tail = atomic_load_explicit(&rbd->tail, memory_order_acquire); // consumer must be done with elements before they are overwritten
+
+  free_elem = rbd->n_elem - _rb_count(rbd, head, tail);
+  if (rbd->overwrite && (free_elem < num))
+  { // discard the oldest data to make room for new data
+    if (num > rbd->n_elem)
+    { // only the last n_elem elements of new data can be stored
+      drop = num - rbd->n_elem;
+      data = (const uint8_t *)data + (drop * rbd->s_elem);
+      num = rbd->n_elem;
+      rbd->dropped += drop;
     }
+    drop = num - free_elem; // move tail instead of copying/clearing discarded elements
+    atomic_store_explicit(&rbd->tail, _rb_advance(rbd, tail, drop), memory_order_relaxed);
+    rbd->dropped += drop;
+    free_elem = num;
+  }
+
+  if (free_elem >= num)
+  { // is there enough space in buffer for num of data
+    _rb_write(rbd, head, data, num);
+
+    status = RB_OK;
+  }
+  else
+  { // there is not enough space in buffer for num of data
+    status = RB_NOT_ENOUGH_SPACE;
+    _rb_stats_rejected(rbd);
   }
+
   rbd->status = status;
   return status;
 }
@@ -143,48 +295,302 @@ rb_status_t ring_buffer_put(rb_att_t *rbd, uint8_t *data, uint32_t num)
 /**
  * @brief Get (and remove) a number of elements from the ring buffer
  * @param *rbd - pointer to the ring buffer descriptor
- * @param data - pointer to store the data
+ * @param data - pointer to store the data (num * s_elem bytes)
  * @param num - number of elements to read
  * @return RB_NOT_ENOUGH_DATA, RB_OK, RB_ERROR
+ * @note Consumer side: only tail is written, safe to call concurrently with ring_buffer_put().
  */
-rb_status_t ring_buffer_get(rb_att_t *rbd, uint8_t *data, uint32_t num)
+rb_status_t ring_buffer_get(rb_att_t *rbd, void *data, uint32_t num)
 {
   rb_status_t status = RB_ERROR;
-  uint32_t num_to_end = 0;
+  uint32_t head, tail;
 
-  if (rbd != NULL)
+  if (rbd == NULL)
   { // rbd must not be a pointer to nowhere
-    if (ring_buffer_size(rbd) >= num)
-    { //buffer is not empty and there is at least num of data stored
-      if (rbd->tail >= rbd->n_elem)
-      { // reset ring buffer tail
-        rbd->tail = 0;
-      }
-
-      num_to_end = rbd->n_elem - rbd->tail;
-      if (num >= num_to_end)
-      {                                                           // is there enough ("num") of data to read before reaching buffer last element
-        memcpy(data, &(rbd->buff[rbd->tail]), num_to_end);        //read from buffer partial data
-        memcpy(data + num_to_end, rbd->buff, (num - num_to_end)); //read from buffer remaining partial data
-
-        rbd->tail = num - num_to_end;  // tail increment
-        rbd->count = rbd->count - num; // decrement counter for num of data
-      }
-      else
-      {                                             //there is enough data to be read before reaching last element of ring buffer
-        memcpy(data, &(rbd->buff[rbd->tail]), num); //read from buffer
-
-        rbd->tail = rbd->tail + num;   // increment tail
-        rbd->count = rbd->count - num; // decrement counter for num of data
-      }
-      status = RB_OK;
-    }
-    else
+    return RB_ERROR;
+  }
+
+  tail = atomic_load_explicit(&rbd->tail, memory_order_relaxed); // tail is written only by this (consumer) side
+  head = atomic_load_explicit(&rbd->head, memory_order_acquire); // data written by producer is visible once head is seen
+
+  if (_rb_count(rbd, head, tail) >= num)
+  { //buffer is not empty and there is at least num of data stored
+    _rb_read(rbd, tail, data, num);
+
+    status = RB_OK;
+  }
+  else
+  {
+    status = RB_NOT_ENOUGH_DATA;
+    _rb_stats_underflow(rbd);
+  }
+
+  rbd->status = status;
+  return status;
+}
+
+/**
+ * @brief Add as many elements as fit (up to num) to the ring buffer
+ * @param *rbd - pointer to the ring buffer descriptor
+ * @param data - the data to add (num * s_elem bytes)
+ * @param num - maximum number of elements to add
+ * @return number of added elements (0 ... num). Status is RB_NOT_ENOUGH_SPACE if not all elements were added.
+ * @note Producer side, same rules as ring_buffer_put(). In overwrite mode, this is the same as ring_buffer_put().
+ */
+uint32_t ring_buffer_put_partial(rb_att_t *rbd, const void *data, uint32_t num)
+{
+  uint32_t head, tail;
+  uint32_t free_elem;
+
+  if (rbd == NULL)
+  { // rbd must not be a pointer to nowhere
+    return 0;
+  }
+
+  if (rbd->overwrite)
+  { // everything fits
+    ring_buffer_put(rbd, data, num);
+    return num;
+  }
+
+  head = atomic_load_explicit(&rbd->head, memory_order_relaxed);
+  tail = atomic_load_explicit(&rbd->tail, memory_order_acquire);
+
+  free_elem = rbd->n_elem - _rb_count(rbd, head, tail);
+  if (free_elem < num)
+  { // write only what fits
+    num = free_elem;
+    rbd->status = RB_NOT_ENOUGH_SPACE;
+    _rb_stats_rejected(rbd);
+  }
+  else
+  {
+    rbd->status = RB_OK;
+  }
+  _rb_write(rbd, head, data, num);
+
+  return num;
+}
+
+/**
+ * @brief Get (and remove) as many elements as available (up to num) from the ring buffer
+ * @param *rbd - pointer to the ring buffer descriptor
+ * @param data - pointer to store the data (num * s_elem bytes)
+ * @param num - maximum number of elements to read
+ * @return number of read elements (0 ... num). Status is RB_NOT_ENOUGH_DATA if less than num elements were read.
+ * @note Consumer side, same rules as ring_buffer_get().
+ */
+uint32_t ring_buffer_get_partial(rb_att_t *rbd, void *data, uint32_t num)
+{
+  uint32_t head, tail;
+  uint32_t count;
+
+  if (rbd == NULL)
+  { // rbd must not be a pointer to nowhere
+    return 0;
+  }
+
+  tail = atomic_load_explicit(&rbd->tail, memory_order_relaxed);
+  head = atomic_load_explicit(&rbd->head, memory_order_acquire);
+
+  count = _rb_count(rbd, head, tail);
+  if (count < num)
+  { // read only what is available
+    num = count;
+    rbd->status = RB_NOT_ENOUGH_DATA;
+    _rb_stats_underflow(rbd);
+  }
+  else
+  {
+    rbd->status = RB_OK;
+  }
+  _rb_read(rbd, tail, data, num);
+
+  return num;
+}
+
+/**
+ * @brief Get (and remove) all bytes up to and including delimiter (for example, '\n' or frame end) from the ring buffer.
+ *        Nothing is read if delimiter is not found within the first num stored bytes.
+ * @param *rbd - pointer to the ring buffer descriptor (byte buffer: s_elem == 1)
+ * @param data - pointer to store the data (up to num bytes)
+ * @param num - maximum number of bytes to read (including delimiter)
+ * @param delim - delimiter byte
+ * @return number of read bytes (including delimiter), 0 if delimiter was not found or on invalid parameters.
+ *         Status is RB_NOT_ENOUGH_DATA if delimiter was not found.
+ * @note Consumer side, same rules as ring_buffer_get(). If buffer is full (or at least num bytes are
+ *       stored) and delimiter is still not found, data must be discarded or read with ring_buffer_get_partial().
+ */
+uint32_t ring_buffer_get_until(rb_att_t *rbd, void *data, uint32_t num, uint8_t delim)
+{
+  uint32_t head, tail;
+  uint32_t count;
+  uint8_t *found;
+  rb_span_t span[2];
+
+  if ((rbd == NULL) || (rbd->s_elem != sizeof(uint8_t)))
+  { // delimiter search is supported on byte buffers only
+    return 0;
+  }
+
+  tail = atomic_load_explicit(&rbd->tail, memory_order_relaxed);
+  head = atomic_load_explicit(&rbd->head, memory_order_acquire);
+
+  count = _rb_count(rbd, head, tail);
+  if (count > num)
+  { // search only data that fits to user buffer
+    count = num;
+  }
+  _rb_spans(rbd, tail, count, span);
+
+  // search contiguous regions instead of byte by byte
+  found = memchr(span[0].data, delim, span[0].num);
+  if (found != NULL)
+  {
+    count = (found - span[0].data) + 1;
+  }
+  else
+  {
+    found = memchr(span[1].data, delim, span[1].num);
+    if (found != NULL)
     {
-      status = RB_NOT_ENOUGH_DATA;
+      count = span[0].num + (found - span[1].data) + 1;
     }
   }
 
+  if (found == NULL)
+  { // empty buffer or no complete frame yet
+    rbd->status = RB_NOT_ENOUGH_DATA;
+    _rb_stats_underflow(rbd);
+    return 0;
+  }
+
+  _rb_read(rbd, tail, data, count);
+
+  rbd->status = RB_OK;
+  return count;
+}
+
+/**
+ * @brief Get free space of the ring buffer as (up to) two contiguous regions, without copying.
+ *        Write data directly into returned regions (span[0] first), then call ring_buffer_commit().
+ * @param *rbd - pointer to the ring buffer descriptor
+ * @param span - array of two spans to store free regions
+ * @return number of free elements (span[0].num + span[1].num), 0 on invalid parameters
+ * @note Producer side, same rules as ring_buffer_put().
+ */
+uint32_t ring_buffer_reserve(rb_att_t *rbd, rb_span_t span[2])
+{
+  uint32_t head, tail;
+  uint32_t num;
+
+  if ((rbd == NULL) || (span == NULL))
+  {
+    return 0;
+  }
+
+  head = atomic_load_explicit(&rbd->head, memory_order_relaxed);
+  tail = atomic_load_explicit(&rbd->tail, memory_order_acquire);
+
+  num = rbd->n_elem - _rb_count(rbd, head, tail);
+  _rb_spans(rbd, head, num, span);
+
+  return num;
+}
+
+/**
+ * @brief Publish a number of elements written directly into regions returned by ring_buffer_reserve().
+ * @param *rbd - pointer to the ring buffer descriptor
+ * @param num - number of written elements
+ * @return RB_NOT_ENOUGH_SPACE, RB_OK, RB_ERROR
+ */
+rb_status_t ring_buffer_commit(rb_att_t *rbd, uint32_t num)
+{
+  rb_status_t status = RB_ERROR;
+  uint32_t head, tail;
+
+  if (rbd == NULL)
+  {
+    return RB_ERROR;
+  }
+
+  head = atomic_load_explicit(&rbd->head, memory_order_relaxed);
+  tail = atomic_load_explicit(&rbd->tail, memory_order_acquire);
+
+  if ((rbd->n_elem - _rb_count(rbd, head, tail)) >= num)
+  {
+    atomic_store_explicit(&rbd->head, _rb_advance(rbd, head, num), memory_order_release);
+    _rb_stats_in(rbd, head, num);
+    status = RB_OK;
+  }
+  else
+  { // more than reserved (free) elements
+    status = RB_NOT_ENOUGH_SPACE;
+    _rb_stats_rejected(rbd);
+  }
+
+  rbd->status = status;
+  return status;
+}
+
+/**
+ * @brief Get stored data of the ring buffer as (up to) two contiguous regions, without copying or removing it.
+ *        Read data directly from returned regions (span[0] first), then call ring_buffer_consume().
+ * @param *rbd - pointer to the ring buffer descriptor
+ * @param span - array of two spans to store data regions
+ * @return number of stored elements (span[0].num + span[1].num), 0 on invalid parameters
+ * @note Consumer side, same rules as ring_buffer_get().
+ */
+uint32_t ring_buffer_peek(rb_att_t *rbd, rb_span_t span[2])
+{
+  uint32_t head, tail;
+  uint32_t num;
+
+  if ((rbd == NULL) || (span == NULL))
+  {
+    return 0;
+  }
+
+  tail = atomic_load_explicit(&rbd->tail, memory_order_relaxed);
+  head = atomic_load_explicit(&rbd->head, memory_order_acquire);
+
+  num = _rb_count(rbd, head, tail);
+  _rb_spans(rbd, tail, num, span);
+
+  return num;
+}
+
+/**
+ * @brief Remove a number of elements, previously read via ring_buffer_peek(), from the ring buffer.
+ * @param *rbd - pointer to the ring buffer descriptor
+ * @param num - number of elements to remove
+ * @return RB_NOT_ENOUGH_DATA, RB_OK, RB_ERROR
+ */
+rb_status_t ring_buffer_consume(rb_att_t *rbd, uint32_t num)
+{
+  rb_status_t status = RB_ERROR;
+  uint32_t head, tail;
+
+  if (rbd == NULL)
+  {
+    return RB_ERROR;
+  }
+
+  tail = atomic_load_explicit(&rbd->tail, memory_order_relaxed);
+  head = atomic_load_explicit(&rbd->head, memory_order_acquire);
+
+  if (_rb_count(rbd, head, tail) >= num)
+  {
+    atomic_store_explicit(&rbd->tail, _rb_advance(rbd, tail, num), memory_order_release);
+    _rb_stats_out(rbd, num);
+    status = RB_OK;
+  }
+  else
+  {
+    status = RB_NOT_ENOUGH_DATA;
+    _rb_stats_underflow(rbd);
+  }
+
   rbd->status = status;
   return status;
 }
@@ -198,16 +604,18 @@ rb_status_t ring_buffer_full(rb_att_t *rbd)
 {
   rb_status_t status = RB_ERROR;
 
-  if (rbd != NULL)
+  if (rbd == NULL)
   {
-    if (rbd->count >= rbd->n_elem)
-    {
-      status = RB_FULL;
-    }
-    else
-    {
-      status = RB_OK;
-    }
+    return RB_ERROR;
+  }
+
+  if (ring_buffer_size(rbd) >= rbd->n_elem)
+  {
+    status = RB_FULL;
+  }
+  else
+  {
+    status = RB_OK;
   }
 
   rbd->status = status;
@@ -223,16 +631,18 @@ rb_status_t ring_buffer_empty(rb_att_t *rbd)
 {
   rb_status_t status = RB_ERROR;
 
-  if (rbd != NULL)
+  if (rbd == NULL)
   {
-    if (rbd->count == 0)
-    {
-      status = RB_EMPTY;
-    }
-    else
-    {
-      status = RB_OK;
-    }
+    return RB_ERROR;
+  }
+
+  if (ring_buffer_size(rbd) == 0)
+  {
+    status = RB_EMPTY;
+  }
+  else
+  {
+    status = RB_OK;
   }
 
   rbd->status = status;
@@ -250,40 +660,101 @@ uint32_t ring_buffer_free_elements(rb_att_t *rbd)
 
   if (rbd != NULL)
   { // rbd must not be a pointer to nowhere
-    ret_val = rbd->n_elem - rbd->count;
+    ret_val = rbd->n_elem - ring_buffer_size(rbd);
   }
 
   return ret_val;
 }
 
 /**
- * @brief Get the number of bytes stored in ring buffer
+ * @brief Get the number of elements stored in ring buffer
  * @param *rbd - pointer to the ring buffer descriptor
  * @return 0 if invalid parameters, number of data stored in buffer otherwise
  */
 uint32_t ring_buffer_size(rb_att_t *rbd)
 {
   uint32_t size = 0;
+  uint32_t head, tail;
 
   if (rbd != NULL)
   { // rbd must not be a pointer to nowhere
-    size = rbd->count;
+    tail = atomic_load_explicit(&rbd->tail, memory_order_acquire);
+    head = atomic_load_explicit(&rbd->head, memory_order_acquire);
+    size = _rb_count(rbd, head, tail);
   }
 
   return size;
 }
 
 /**
- * @brief Flush data from ring buffer (discard head, tail and count data)
+ * @brief Enable/disable overwrite mode. In overwrite mode, ring_buffer_put() discards the oldest elements
+ *        (in constant time) instead of rejecting new data when buffer is full - useful for trace/history logs.
  * @param *rbd - pointer to the ring buffer descriptor
+ * @param enable - true to enable overwrite mode, false to reject data that doesn't fit (default)
+ * @note In overwrite mode producer also moves tail, so buffer is not lock-free anymore: put and get
+ *       (or peek/consume) must not run concurrently.
+ */
+void ring_buffer_set_overwrite(rb_att_t *rbd, bool enable)
+{
+  if (rbd != NULL)
+  {
+    rbd->overwrite = enable;
+  }
+}
+
+/**
+ * @brief Get number of elements discarded in overwrite mode (since init or last flush)
+ * @param *rbd - pointer to the ring buffer descriptor
+ * @return 0 if invalid parameters, number of discarded elements otherwise
+ */
+uint32_t ring_buffer_get_dropped(rb_att_t *rbd)
+{
+  uint32_t dropped = 0;
+
+  if (rbd != NULL)
+  {
+    dropped = rbd->dropped;
+  }
+
+  return dropped;
+}
+
+/**
+ * @brief Flush data from ring buffer (discard all stored data). Only indexes are reset, data is not cleared,
+ *        so this takes constant time regardless of buffer size (see ring_buffer_wipe()).
+ * @param *rbd - pointer to the ring buffer descriptor
+ * @note Consumer side: only tail is written, safe to call concurrently with ring_buffer_put().
  */
 void ring_buffer_flush(rb_att_t *rbd)
 {
-  rbd->head = 0;
-  rbd->tail = 0;
-  rbd->count = 0;
+  if (rbd == NULL)
+  {
+    return;
+  }
+
+  // discard everything producer has published so far
+  atomic_store_explicit(&rbd->tail, atomic_load_explicit(&rbd->head, memory_order_acquire), memory_order_release);
+  rbd->dropped = 0;
+}
+
+/**
+ * @brief Flush data from ring buffer and clear (set to 0) all buffer memory, for example to
+ *        remove sensitive data. Takes time proportional to buffer size.
+ * @param *rbd - pointer to the ring buffer descriptor
+ * @note Must not be called concurrently with ring_buffer_put()/ring_buffer_get().
+ */
+void ring_buffer_wipe(rb_att_t *rbd)
+{
+  if (rbd == NULL)
+  {
+    return;
+  }
+
+  atomic_store_explicit(&rbd->head, 0, memory_order_relaxed);
+  atomic_store_explicit(&rbd->tail, 0, memory_order_relaxed);
+  rbd->dropped = 0;
 
-  memset(rbd->buff, 0, rbd->n_elem); // set all values back to 0.
+  memset(rbd->buff, 0, rbd->n_elem * rbd->s_elem); // set all values back to 0.
 }
 
 /**
@@ -294,3 +765,244 @@ rb_status_t ring_buffer_get_status(rb_att_t *rbd)
 {
   return rbd->status;
 }
+
+#ifdef RB_STATISTICS
+/**
+ * @brief Get ring buffer usage statistics
+ * @param *rbd - pointer to the ring buffer descriptor
+ * @param *stats - pointer to store statistics
+ */
+void ring_buffer_get_stats(rb_att_t *rbd, rb_stats_t *stats)
+{
+  if ((rbd == NULL) || (stats == NULL))
+  {
+    return;
+  }
+
+  stats->high_water = rbd->stats.high_water;
+  stats->total_in = rbd->stats.total_in;
+  stats->total_out = rbd->stats.total_out;
+  stats->rejected = rbd->stats.rejected;
+  stats->underflows = rbd->stats.underflows;
+}
+
+/**
+ * @brief Reset ring buffer usage statistics (high-water mark is set to number of currently stored elements)
+ * @param *rbd - pointer to the ring buffer descriptor
+ * @note Should not be called concurrently with put/get, or some counts might be lost.
+ */
+void ring_buffer_reset_stats(rb_att_t *rbd)
+{
+  if (rbd == NULL)
+  {
+    return;
+  }
+
+  rbd->stats.high_water = ring_buffer_size(rbd);
+  rbd->stats.total_in = 0;
+  rbd->stats.total_out = 0;
+  rbd->stats.rejected = 0;
+  rbd->stats.underflows = 0;
+}
+#endif
+
+/**
+ * @brief Private function: get number of elements between tail and head index.
+ * @param *rbd - pointer to the ring buffer descriptor
+ * @param head - head index
+ * @param tail - tail index
+ * @return number of stored elements (0 ... n_elem)
+ */
+static inline uint32_t _rb_count(rb_att_t *rbd, uint32_t head, uint32_t tail)
+{
+#ifdef RB_POWER_OF_TWO_SIZE
+  (void)rbd;
+  return head - tail; // free-running indexes, unsigned arithmetic handles overflow
+#else
+  if (head >= tail)
+  {
+    return head - tail;
+  }
+  else
+  {
+    return (2 * rbd->n_elem) - tail + head;
+  }
+#endif
+}
+
+/**
+ * @brief Private function: get buffer element offset of head/tail index.
+ * @param *rbd - pointer to the ring buffer descriptor
+ * @param idx - head or tail index
+ * @return offset in buffer (0 ... n_elem-1)
+ */
+static inline uint32_t _rb_offset(rb_att_t *rbd, uint32_t idx)
+{
+#ifdef RB_POWER_OF_TWO_SIZE
+  return idx & (rbd->n_elem - 1);
+#else
+  if (idx >= rbd->n_elem)
+  {
+    return idx - rbd->n_elem;
+  }
+  return idx;
+#endif
+}
+
+/**
+ * @brief Private function: move head/tail index for a number of elements.
+ * @param *rbd - pointer to the ring buffer descriptor
+ * @param idx - head or tail index
+ * @param num - number of elements to move index for (0 ... n_elem)
+ * @return new index
+ */
+static inline uint32_t _rb_advance(rb_att_t *rbd, uint32_t idx, uint32_t num)
+{
+#ifdef RB_POWER_OF_TWO_SIZE
+  (void)rbd;
+  return idx + num; // free-running index, wraps at UINT32_MAX
+#else
+  idx += num;
+  if (idx >= (2 * rbd->n_elem))
+  {
+    idx -= (2 * rbd->n_elem);
+  }
+  return idx;
+#endif
+}
+
+/**
+ * @brief Private function: split a number of elements from head/tail index into contiguous regions.
+ * @param *rbd - pointer to the ring buffer descriptor
+ * @param idx - head or tail index
+ * @param num - number of elements (0 ... n_elem)
+ * @param span - array of two spans: span[0] from idx offset, span[1] (wrapped part) from buffer start
+ */
+static inline void _rb_spans(rb_att_t *rbd, uint32_t idx, uint32_t num, rb_span_t span[2])
+{
+  uint32_t offset = _rb_offset(rbd, idx);
+  uint32_t num_to_end = rbd->n_elem - offset; // that many elements fit before reaching buffer last element
+
+  span[0].data = &(rbd->buff[offset * rbd->s_elem]);
+  span[1].data = rbd->buff;
+  if (num > num_to_end)
+  {
+    span[0].num = num_to_end;
+    span[1].num = num - num_to_end;
+  }
+  else
+  {
+    span[0].num = num;
+    span[1].num = 0;
+  }
+}
+
+/**
+ * @brief Private function: copy elements into buffer at head index and publish them to consumer.
+ * @param *rbd - pointer to the ring buffer descriptor
+ * @param head - current head index
+ * @param data - the data to add
+ * @param num - number of elements to add (must fit in free space)
+ */
+static void _rb_write(rb_att_t *rbd, uint32_t head, const void *data, uint32_t num)
+{
+  rb_span_t span[2];
+
+  _rb_spans(rbd, head, num, span); // data can wrap over buffer last element
+  memcpy(span[0].data, data, span[0].num * rbd->s_elem);
+  if (span[1].num)
+  { // second copy only when data wraps (avoid memcpy() call overhead on every put)
+    memcpy(span[1].data, (const uint8_t *)data + (span[0].num * rbd->s_elem), span[1].num * rbd->s_elem);
+  }
+
+  // publish data to consumer: release ordering guarantees data is written before head is moved
+  atomic_store_explicit(&rbd->head, _rb_advance(rbd, head, num), memory_order_release);
+  _rb_stats_in(rbd, head, num);
+}
+
+/**
+ * @brief Private function: copy elements from buffer at tail index and release them to producer.
+ * @param *rbd - pointer to the ring buffer descriptor
+ * @param tail - current tail index
+ * @param data - pointer to store the data
+ * @param num - number of elements to read (must be stored in buffer)
+ */
+static void _rb_read(rb_att_t *rbd, uint32_t tail, void *data, uint32_t num)
+{
+  rb_span_t span[2];
+
+  _rb_spans(rbd, tail, num, span); // data can wrap over buffer last element
+  memcpy(data, span[0].data, span[0].num * rbd->s_elem);
+  if (span[1].num)
+  { // second copy only when data wraps
+    memcpy((uint8_t *)data + (span[0].num * rbd->s_elem), span[1].data, span[1].num * rbd->s_elem);
+  }
+
+  // release elements to producer: release ordering guarantees data is read before tail is moved
+  atomic_store_explicit(&rbd->tail, _rb_advance(rbd, tail, num), memory_order_release);
+  _rb_stats_out(rbd, num);
+}
+
+/**
+ * @brief Private function: update producer side statistics after elements were published (no-op without RB_STATISTICS).
+ * @param *rbd - pointer to the ring buffer descriptor
+ * @param head - head index before elements were published
+ * @param num - number of published elements
+ */
+static inline void _rb_stats_in(rb_att_t *rbd, uint32_t head, uint32_t num)
+{
+#ifdef RB_STATISTICS
+  uint32_t count = _rb_count(rbd, head, atomic_load_explicit(&rbd->tail, memory_order_relaxed)) + num;
+
+  rbd->stats.total_in += num;
+  if (count > rbd->stats.high_water)
+  {
+    rbd->stats.high_water = count;
+  }
+#else
+  (void)rbd;
+  (void)head;
+  (void)num;
+#endif
+}
+
+/**
+ * @brief Private function: update consumer side statistics after elements were released (no-op without RB_STATISTICS).
+ * @param *rbd - pointer to the ring buffer descriptor
+ * @param num - number of released elements
+ */
+static inline void _rb_stats_out(rb_att_t *rbd, uint32_t num)
+{
+#ifdef RB_STATISTICS
+  rbd->stats.total_out += num;
+#else
+  (void)rbd;
+  (void)num;
+#endif
+}
+
+/**
+ * @brief Private function: count put/commit call that failed or was cut short (no-op without RB_STATISTICS).
+ * @param *rbd - pointer to the ring buffer descriptor
+ */
+static inline void _rb_stats_rejected(rb_att_t *rbd)
+{
+#ifdef RB_STATISTICS
+  rbd->stats.rejected++;
+#else
+  (void)rbd;
+#endif
+}
+
+/**
+ * @brief Private function: count get/consume call that failed or was cut short (no-op without RB_STATISTICS).
+ * @param *rbd - pointer to the ring buffer descriptor
+ */
+static inline void _rb_stats_underflow(rb_att_t *rbd)
+{
+#ifdef RB_STATISTICS
+  rbd->stats.underflows++;
+#else
+  (void)rbd;
+#endif
+}
@@ -3,9 +3,9 @@
  * File Name          : ring_buffer
  * Description        : This file provides code for the initialization
  *                      of circular (ring) buffer
- * @date    30-May-2020
+ * @date    16-Oct-2026
  * @author  Originally: Chris Karaplis, modified by Domen Jurkovic
- * @version v1.3
+ * @version v1.4
  *
  * Copyright (c) 2015, simplyembedded.org
  * Copyright (c) 2020, damogranlabs.com
@@ -47,6 +47,11 @@
 #define __RING_BUFFER_H
 
 #include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+//#define RB_POWER_OF_TWO_SIZE // uncomment if all ring buffers have power-of-two size (faster: free-running indexes are masked instead of wrapped)
+//#define RB_STATISTICS        // uncomment to collect usage statistics (high-water mark, throughput, errors) for buffer sizing
 
 typedef enum
 {
@@ -58,20 +63,100 @@ typedef enum
   RB_NOT_ENOUGH_DATA   // there is not enaugh data in buffer
 } rb_status_t;
 
+#ifdef RB_STATISTICS
+/*
+ * Usage statistics. Producer side counters (high_water, total_in, rejected) are written only by
+ * put/commit, consumer side counters (total_out, underflows) only by get/consume.
+ */
 typedef struct
 {
-  uint8_t *buff;      // actual buffer
-  uint32_t n_elem;    // number of s_elem sized elements in this buffer
-  uint32_t head;      // number of first free element in buffer (0 ... n_elem-1)
-  uint32_t tail;      // number of last used element in buffer (0 ... n_elem-1)
-  uint32_t count;     // number of elements stored in buffer  (0 ... n_elem)
-  rb_status_t status; //current status of ring buffer
+  uint32_t high_water; // maximum number of elements stored in buffer at once
+  uint32_t total_in;   // total number of elements put into buffer
+  uint32_t total_out;  // total number of elements read/removed from buffer
+  uint32_t rejected;   // number of put/commit calls that failed or were cut short (RB_NOT_ENOUGH_SPACE)
+  uint32_t underflows; // number of get/consume calls that failed or were cut short (RB_NOT_ENOUGH_DATA)
+} rb_stats_t;
+#endif
+
+/*
+ * Head and tail indexes run in range 0 ... 2*n_elem-1 (or free-running 0 ... UINT32_MAX in case of
+ * RB_POWER_OF_TWO_SIZE), so full and empty buffer can be told apart without a shared element counter.
+ * Head is written only by the producer (ring_buffer_put()), tail only by the consumer (ring_buffer_get()),
+ * which makes buffer lock-free for one producer and one consumer (for example: UART RX interrupt -> main loop)
+ * - no critical sections required.
+ * NOTE: status is written by both sides - when used concurrently, it holds the result of whichever call was last.
+ */
+typedef struct
+{
+  uint8_t *buff;            // actual buffer
+  uint32_t n_elem;          // number of s_elem sized elements in this buffer
+  uint32_t s_elem;          // size of one element in bytes (1 for byte buffers)
+  _Atomic uint32_t head;    // index of first free element in buffer, written only by producer
+  _Atomic uint32_t tail;    // index of first used element in buffer, written only by consumer
+  rb_status_t status;       //current status of ring buffer
+  bool is_allocated;        // buff was allocated by ring_buffer_init() and is freed by ring_buffer_deinit()
+  bool overwrite;           // if true, ring_buffer_put() discards the oldest elements instead of rejecting new ones
+  uint32_t dropped;         // number of elements discarded in overwrite mode
+#ifdef RB_STATISTICS
+  rb_stats_t stats; // usage statistics
+#endif
 } volatile rb_att_t;
 
+/*
+ * Contiguous region of ring buffer memory. Free or stored data can wrap over buffer last element,
+ * so it is described with (up to) two spans: span[0] from head/tail offset, span[1] from buffer start.
+ */
+typedef struct
+{
+  uint8_t *data; // pointer to the first element of region
+  uint32_t num;  // number of elements in region (0 if span is not used), region size in bytes is num * s_elem
+} rb_span_t;
+
+/*
+ * Define ring buffer descriptor 'name' together with its statically allocated storage of 'size' bytes
+ * (or 'num' elements of 'type'). No heap is used and no ring_buffer_init() call is required.
+ * _STATIC variants define descriptor with internal linkage (buffer private to a module).
+ * Example (at file scope):
+ *    RING_BUFFER_DEFINE(rx_buff, 128);
+ *    RING_BUFFER_DEFINE_TYPED(samples, sensor_sample_t, 32);
+ *    RING_BUFFER_DEFINE_STATIC(tx_buff, 64);
+ */
+#ifdef RB_POWER_OF_TWO_SIZE
+#define _RB_SIZE_VALID(n_elem, s_elem) (((s_elem) > 0) && ((n_elem) > 0) && ((n_elem) <= (UINT32_MAX / 2)) && \
+                                        ((n_elem) <= (UINT32_MAX / (s_elem))) && (((n_elem) & ((n_elem)-1)) == 0))
+#else
+#define _RB_SIZE_VALID(n_elem, s_elem) (((s_elem) > 0) && ((n_elem) > 0) && ((n_elem) <= (UINT32_MAX / 2)) && \
+                                        ((n_elem) <= (UINT32_MAX / (s_elem))))
+#endif
+
+#define _RING_BUFFER_DEFINE(linkage, name, type, num)                                                        \
+  _Static_assert(_RB_SIZE_VALID((num), sizeof(type)), "invalid ring buffer size: " #name);                   \
+  static type name##_storage[(num)];                                                                         \
+  linkage rb_att_t name = {.buff = (uint8_t *)name##_storage, .n_elem = (num), .s_elem = sizeof(type),       \
+                           .head = 0, .tail = 0, .status = RB_OK, .is_allocated = false, .overwrite = false, \
+                           .dropped = 0}
+
+#define RING_BUFFER_DEFINE_TYPED(name, type, num) _RING_BUFFER_DEFINE(, name, type, num)
+#define RING_BUFFER_DEFINE_STATIC_TYPED(name, type, num) _RING_BUFFER_DEFINE(static, name, type, num)
+#define RING_BUFFER_DEFINE(name, size) RING_BUFFER_DEFINE_TYPED(name, uint8_t, size)
+#define RING_BUFFER_DEFINE_STATIC(name, size) RING_BUFFER_DEFINE_STATIC_TYPED(name, uint8_t, size)
+
 rb_status_t ring_buffer_init(rb_att_t *rbd, uint32_t size);
+rb_status_t ring_buffer_init_static(rb_att_t *rbd, uint8_t *storage, uint32_t size);
+rb_status_t ring_buffer_init_elem(rb_att_t *rbd, uint32_t n_elem, uint32_t s_elem);
+rb_status_t ring_buffer_init_static_elem(rb_att_t *rbd, void *storage, uint32_t n_elem, uint32_t s_elem);
+void ring_buffer_deinit(rb_att_t *rbd);
+
+rb_status_t ring_buffer_put(rb_att_t *rbd, const void *data, uint32_t num);
+rb_status_t ring_buffer_get(rb_att_t *rbd, void *data, uint32_t num);
+uint32_t ring_buffer_put_partial(rb_att_t *rbd, const void *data, uint32_t num);
+uint32_t ring_buffer_get_partial(rb_att_t *rbd, void *data, uint32_t num);
+uint32_t ring_buffer_get_until(rb_att_t *rbd, void *data, uint32_t num, uint8_t delim);
 
-rb_status_t ring_buffer_put(rb_att_t *rbd, uint8_t *data, uint32_t num);
-rb_status_t ring_buffer_get(rb_att_t *rbd, uint8_t *data, uint32_t num);
+uint32_t ring_buffer_reserve(rb_att_t *rbd, rb_span_t span[2]);
+rb_status_t ring_buffer_commit(rb_att_t *rbd, uint32_t num);
+uint32_t ring_buffer_peek(rb_att_t *rbd, rb_span_t span[2]);
+rb_status_t ring_buffer_consume(rb_att_t *rbd, uint32_t num);
 
 rb_status_t ring_buffer_full(rb_att_t *rbd);
 rb_status_t ring_buffer_empty(rb_att_t *rbd);
@@ -79,7 +164,16 @@ rb_status_t ring_buffer_empty(rb_att_t *rbd);
 uint32_t ring_buffer_free_elements(rb_att_t *rbd);
 uint32_t ring_buffer_size(rb_att_t *rbd);
 
+void ring_buffer_set_overwrite(rb_att_t *rbd, bool enable);
+uint32_t ring_buffer_get_dropped(rb_att_t *rbd);
+
 void ring_buffer_flush(rb_att_t *rbd);
+void ring_buffer_wipe(rb_att_t *rbd);
 rb_status_t ring_buffer_get_status(rb_att_t *rbd);
 
+#ifdef RB_STATISTICS
+void ring_buffer_get_stats(rb_att_t *rbd, rb_stats_t *stats);
+void ring_buffer_reset_stats(rb_att_t *rbd);
+#endif
+
 #endif
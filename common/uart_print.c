@@ -1,20 +1,61 @@
 /*
  * Template library for creating an Arduino-like UART print API.
- * @date    26-Apr-2020
+ * @date    16-Oct-2026
  * @author  Domen Jurkovic
  * @source  http://damogranlabs.com/
  *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ *
+ * Buffered mode (UART_PRINT_BUFFERED defined in uart_print_user.h):
+ * Printed fragments (strings, signs, digits, new lines) are collected in a ring buffer instead of separate
+ * send_data() calls. Buffer is sent when new line is printed, when it is full, or with printFlush().
+ * With UART_PRINT_DMA, buffer is drained with non-blocking send_data_start() transfers: user calls
+ * printTxComplete() when transfer is finished (DMA/UART interrupt), and next transfer is started from there.
+ * Print functions wait only if buffer is full.
  */
 #include "uart_print.h"
 #include "uart_print_user.h"
 
-#include <stdio.h>
 #include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 #include <math.h>
 
-void _printUnsignedNumber(uint32_t n, uint8_t base);
+#ifdef UART_PRINT_BUFFERED
+#include "ring_buffer.h"
+#ifdef UART_PRINT_DMA
+#include <stdatomic.h>
+#endif
+#endif
+
+void _printNumber(uint64_t n, bool negative, uint8_t base, uint8_t width, bool zero_pad);
+char *_printFormatUnsigned(char *end, uint32_t n, uint8_t base);
+char *_printFormatUnsigned64(char *end, uint64_t n, uint8_t base);
+uint32_t _printRoundFraction(uint64_t m, uint8_t shift, uint32_t scale, bool int_odd);
+void _printWrite(const char *data, uint16_t size);
+
+#ifdef UART_PRINT_BUFFERED
+RING_BUFFER_DEFINE_STATIC(_print_buff, UART_PRINT_BUFFER_SIZE);
+
+#ifdef UART_PRINT_DMA
+static atomic_bool _print_tx_busy;     // send_data_start() transfer in progress, set only by main code
+static volatile uint16_t _print_tx_len; // size of data in transfer
+
+bool _printStartTx(void);
+#endif
+#endif
+
+// "00" - "99", two decimal digits per conversion step
+static const char _print_digits2[200] = {
+    '0', '0', '0', '1', '0', '2', '0', '3', '0', '4', '0', '5', '0', '6', '0', '7', '0', '8', '0', '9',
+    '1', '0', '1', '1', '1', '2', '1', '3', '1', '4', '1', '5', '1', '6', '1', '7', '1', '8', '1', '9',
+    '2', '0', '2', '1', '2', '2', '2', '3', '2', '4', '2', '5', '2', '6', '2', '7', '2', '8', '2', '9',
+    '3', '0', '3', '1', '3', '2', '3', '3', '3', '4', '3', '5', '3', '6', '3', '7', '3', '8', '3', '9',
+    '4', '0', '4', '1', '4', '2', '4', '3', '4', '4', '4', '5', '4', '6', '4', '7', '4', '8', '4', '9',
+    '5', '0', '5', '1', '5', '2', '5', '3', '5', '4', '5', '5', '5', '6', '5', '7', '5', '8', '5', '9',
+    '6', '0', '6', '1', '6', '2', '6', '3', '6', '4', '6', '5', '6', '6', '6', '7', '6', '8', '6', '9',
+    '7', '0', '7', '1', '7', '2', '7', '3', '7', '4', '7', '5', '7', '6', '7', '7', '7', '8', '7', '9',
+    '8', '0', '8', '1', '8', '2', '8', '3', '8', '4', '8', '5', '8', '6', '8', '7', '8', '8', '8', '9',
+    '9', '0', '9', '1', '9', '2', '9', '3', '9', '4', '9', '5', '9', '6', '9', '7', '9', '8', '9', '9'};
 
 /**
  * @brief Send/print readable character/string.
@@ -24,7 +65,7 @@ void _printUnsignedNumber(uint32_t n, uint8_t base);
  */
 void printString(char *data)
 {
-  send_data((uint8_t *)data, (uint16_t)strlen(data));
+  _printWrite(data, (uint16_t)strlen(data));
 }
 
 /**
@@ -36,16 +77,7 @@ void printString(char *data)
  */
 void printNumber(int32_t number, uint8_t base)
 {
-  if (number < 0)
-  {
-    printString("-");
-    number = -number;
-    _printUnsignedNumber(number, base);
-  }
-  else
-  {
-    _printUnsignedNumber(number, base);
-  }
+  _printNumber((number < 0) ? (0U - (uint32_t)number) : (uint32_t)number, (number < 0), base, 0, false);
 }
 
 /**
@@ -53,7 +85,7 @@ void printNumber(int32_t number, uint8_t base)
  */
 void printStringLn(char *data)
 {
-  send_data((uint8_t *)data, (uint16_t)strlen(data));
+  _printWrite(data, (uint16_t)strlen(data));
   printLn();
 }
 
@@ -62,16 +94,42 @@ void printStringLn(char *data)
  */
 void printNumberLn(int32_t number, uint8_t base)
 {
-  if (number < 0)
-  {
-    printString("-");
-    number = -number;
-    _printUnsignedNumber(number, base);
-  }
-  else
-  {
-    _printUnsignedNumber(number, base);
-  }
+  printNumber(number, base);
+  printLn();
+}
+
+/**
+ * @brief Send/print number as a readable string, right-aligned to fixed width.
+ * @param number to convert to a readable string
+ * @param decode base: DEC, HEX, OCT, BIN
+ * @param width - minimum number of characters (including sign), longer numbers are printed in full
+ * @param zero_pad - true to pad with leading zeros ("-007"), false to pad with spaces ("  -7")
+ * @example printNumberWidth(7, DEC, 3, true); // "007"
+ * @retval None
+ */
+void printNumberWidth(int32_t number, uint8_t base, uint8_t width, bool zero_pad)
+{
+  _printNumber((number < 0) ? (0U - (uint32_t)number) : (uint32_t)number, (number < 0), base, width, zero_pad);
+}
+
+/**
+ * @brief Send/print 64-bit number as a readable string.
+ * @param number to convert to a readable string
+ * @param decode base: DEC, HEX, OCT, BIN
+ * @example printNumber64(uptime_us, DEC);
+ * @retval None
+ */
+void printNumber64(int64_t number, uint8_t base)
+{
+  _printNumber((number < 0) ? (0ULL - (uint64_t)number) : (uint64_t)number, (number < 0), base, 0, false);
+}
+
+/**
+ * @brief Same as printNumber64() but append newline.
+ */
+void printNumber64Ln(int64_t number, uint8_t base)
+{
+  printNumber64(number, base);
   printLn();
 }
 
@@ -86,17 +144,15 @@ void printLn()
 }
 
 /**
- * @brief Send/print float number as a readable string.
+ * @brief Send/print float number as a readable string, with PRINT_FLOAT_DECIMALS decimals.
  * @param number to convert to a readable string
- * @example printFloat(number, DEC);
- * @note pay attention on "double" type range - approximately 6 digits after decimal point?
+ * @example printFloat(number);
+ * @note See printFloatDecimals().
  * @retval None
  */
 void printFloat(double number)
 {
-  char float_as_string[20];
-  sprintf(float_as_string, "%f", number);
-  printString(float_as_string);
+  printFloatDecimals(number, PRINT_FLOAT_DECIMALS);
 }
 
 /**
@@ -104,36 +160,441 @@ void printFloat(double number)
  */
 void printFloatLn(double number)
 {
-  printFloat(number);
+  printFloatDecimals(number, PRINT_FLOAT_DECIMALS);
   printLn();
 }
 
 /**
- * @brief Private function: send/print unsigned number as a readable string.
+ * @brief Send/print float number as a readable string, with selected number of decimals. Number is correctly
+ *        rounded (same result as printf("%.*f")), without printf and floating point arithmetic.
+ *        Not-a-number is printed as "nan"/"-nan" and infinity as "inf"/"-inf", same as printf().
+ *        Limit: integer part must fit in 64 bits. Unlike printf(), finite numbers >= 2^64 (~1.8e19) are printed
+ *        as "ovf"/"-ovf".
  * @param number to convert to a readable string
- * @param decode base: DEC, HEX, OCT, BIN
- * @example _printUnsignedNumber(number, DEC);
+ * @param decimals: number of digits after decimal point, 0 - PRINT_FLOAT_MAX_DECIMALS (no decimal point if 0)
+ * @example printFloatDecimals(3.14159, 2); // "3.14"
  * @retval None
  */
-void _printUnsignedNumber(uint32_t n, uint8_t base)
+void printFloatDecimals(double number, uint8_t decimals)
 {
-  char buf[8 * sizeof(long) + 1]; // Assumes 8-bit chars plus zero byte.
+  // sign, 20 digits of 64-bit integer part, decimal point, decimals, zero byte
+  char buf[1 + 20 + 1 + PRINT_FLOAT_MAX_DECIMALS + 1];
   char *str = &buf[sizeof(buf) - 1];
-  unsigned long m;
-  char c;
+  char *end;
+  uint32_t scale = 1;
+  uint64_t m;        // mantissa, number = m * 2^exp
+  int exp;
+  uint64_t int_part;
+  uint32_t fraction; // decimals, as integer
+  uint8_t i;
+
+  if (isnan(number))
+  {
+    printString(signbit(number) ? "-nan" : "nan");
+    return;
+  }
+  if (isinf(number))
+  {
+    printString((number < 0) ? "-inf" : "inf");
+    return;
+  }
+  if (fabs(number) >= 18446744073709551616.0) // 2^64
+  {
+    printString((number < 0) ? "-ovf" : "ovf");
+    return;
+  }
+
+  if (decimals > PRINT_FLOAT_MAX_DECIMALS)
+  {
+    decimals = PRINT_FLOAT_MAX_DECIMALS;
+  }
+  for (i = 0; i < decimals; i++)
+  {
+    scale *= 10;
+  }
+
+  // exact integer mantissa (53 bits) and binary exponent
+  m = (uint64_t)ldexp(frexp(fabs(number), &exp), 53);
+  exp -= 53;
+
+  if (exp >= 0)
+  { // no fraction, |number| < 2^64 so exp <= 11
+    int_part = m << exp;
+    fraction = 0;
+  }
+  else if (exp > -64)
+  {
+    int_part = m >> -exp;
+    fraction = _printRoundFraction(m & ((1ULL << -exp) - 1), -exp, scale, int_part & 1);
+  }
+  else
+  {
+    int_part = 0;
+    fraction = (exp >= -255) ? _printRoundFraction(m, -exp, scale, false) : 0; // else number < 2^-202: rounded to 0
+  }
+  if (fraction >= scale)
+  { // rounded up to next integer
+    fraction -= scale;
+    int_part++;
+  }
+
   *str = '\0';
+  if (decimals)
+  {
+    end = str;
+    str = _printFormatUnsigned(end, fraction, DEC);
+    while (str > (end - decimals))
+    { // leading zeros after decimal point
+      *--str = '0';
+    }
+    *--str = '.';
+  }
+  str = _printFormatUnsigned64(str, int_part, DEC);
+  if (signbit(number))
+  { // also "-0.00" for small negative numbers, same as printf()
+    *--str = '-';
+  }
+
+  printString(str);
+}
+
+/**
+ * @brief Same as printFloatDecimals() but append newline.
+ */
+void printFloatDecimalsLn(double number, uint8_t decimals)
+{
+  printFloatDecimals(number, decimals);
+  printLn();
+}
+
+/**
+ * @brief Send all buffered data (UART_PRINT_BUFFERED). Without UART_PRINT_DMA, data is sent with blocking
+ *        send_data() calls, otherwise transfer is only started (if not already in progress).
+ *        Without UART_PRINT_BUFFERED, data is sent immediately and this function does nothing.
+ * @example printString("x = "); printNumber(x, DEC); printFlush();
+ * @retval None
+ */
+void printFlush(void)
+{
+#ifdef UART_PRINT_BUFFERED
+#ifdef UART_PRINT_DMA
+  // printTxComplete() is called only while transfer is in progress: if it isn't, flag can't change meanwhile
+  if (!atomic_load(&_print_tx_busy))
+  {
+    atomic_store(&_print_tx_busy, true);
+    if (!_printStartTx())
+    {
+      atomic_store(&_print_tx_busy, false);
+    }
+  }
+#else
+  rb_span_t span[2];
+  uint32_t num = ring_buffer_peek(&_print_buff, span);
+
+  if (num == 0)
+  {
+    return;
+  }
+  // buffered data can wrap over buffer end: up to two send_data() calls
+  send_data(span[0].data, (uint16_t)span[0].num);
+  if (span[1].num)
+  {
+    send_data(span[1].data, (uint16_t)span[1].num);
+  }
+  ring_buffer_consume(&_print_buff, num);
+#endif
+#endif
+}
+
+/**
+ * @brief Notify library that send_data_start() transfer is finished (UART_PRINT_DMA), call it from DMA/UART
+ *        transfer complete interrupt. Next transfer is started if there is more buffered data.
+ * @retval None
+ */
+void printTxComplete(void)
+{
+#if defined(UART_PRINT_BUFFERED) && defined(UART_PRINT_DMA)
+  ring_buffer_consume(&_print_buff, _print_tx_len);
+  if (!_printStartTx())
+  { // all data is sent, next transfer is started by printFlush()
+    atomic_store(&_print_tx_busy, false);
+  }
+#endif
+}
+
+/**
+ * @brief Private function: send/print number as a readable string.
+ * @param n - absolute value of number
+ * @param negative - true to print minus sign
+ * @param decode base: DEC, HEX, OCT, BIN
+ * @param width - minimum number of characters, number is right-aligned (0: no padding)
+ * @param zero_pad - true to pad with leading zeros ("-007"), false to pad with spaces ("  -7")
+ * @example _printNumber(number, false, DEC, 0, false);
+ * @retval None
+ */
+void _printNumber(uint64_t n, bool negative, uint8_t base, uint8_t width, bool zero_pad)
+{
+  char buf[1 + 64 + 1]; // sign, 64 binary digits, zero byte
+  char *end = &buf[sizeof(buf) - 1];
+  char *str;
+  uint8_t len;
 
   //prevent crash if called with base == 1
   if (base < 2)
     base = 10;
+  if (width > (sizeof(buf) - 1))
+    width = sizeof(buf) - 1;
 
-  do
+  *end = '\0';
+  if (n > UINT32_MAX)
   {
-    m = n;
-    n /= base;
-    c = m - base * n;
-    *--str = c < 10 ? c + '0' : c + 'A' - 10;
-  } while (n);
+    str = _printFormatUnsigned64(end, n, base);
+  }
+  else
+  { // 32-bit arithmetic is much faster on 32-bit MCU
+    str = _printFormatUnsigned(end, (uint32_t)n, base);
+  }
+  len = (end - str) + negative;
 
-  printString(str);
+  if (zero_pad)
+  {
+    while (len < width)
+    {
+      *--str = '0';
+      len++;
+    }
+  }
+  if (negative)
+  {
+    *--str = '-';
+  }
+  while (len < width)
+  {
+    *--str = ' ';
+    len++;
+  }
+
+  _printWrite(str, end - str);
+}
+
+/**
+ * @brief Private function: convert unsigned number to digits, written backwards from end of buffer.
+ *        Power of two bases (BIN, OCT, HEX) use shift and mask, DEC converts two digits per step with
+ *        multiplication by reciprocal (no division, which is slow on MCUs without hardware divider).
+ * @param end - pointer after the last digit
+ * @param n - number to convert
+ * @param decode base: DEC, HEX, OCT, BIN (2 - 36)
+ * @retval pointer to the first digit
+ */
+char *_printFormatUnsigned(char *end, uint32_t n, uint8_t base)
+{
+  uint8_t shift = 0;
+  uint32_t q;
+  uint8_t c;
+
+  if (base == DEC)
+  {
+    while (n >= 100)
+    {
+      q = (uint32_t)(((uint64_t)n * 0x51EB851F) >> 37); // n / 100, exact for all 32-bit numbers
+      end -= 2;
+      memcpy(end, &_print_digits2[(n - q * 100) * 2], 2);
+      n = q;
+    }
+    if (n >= 10)
+    {
+      end -= 2;
+      memcpy(end, &_print_digits2[n * 2], 2);
+    }
+    else
+    {
+      *--end = '0' + n;
+    }
+  }
+  else if ((base & (base - 1)) == 0)
+  { // BIN, OCT, HEX
+    while ((1U << shift) < base)
+    {
+      shift++;
+    }
+    do
+    {
+      c = n & (base - 1);
+      *--end = c < 10 ? c + '0' : c + 'A' - 10;
+      n >>= shift;
+    } while (n);
+  }
+  else
+  {
+    do
+    {
+      q = n / base;
+      c = n - base * q;
+      *--end = c < 10 ? c + '0' : c + 'A' - 10;
+      n = q;
+    } while (n);
+  }
+  return end;
+}
+
+/**
+ * @brief Private function: same as _printFormatUnsigned(), for 64-bit numbers.
+ *        DEC numbers are split on 8 digit parts, each converted with 32-bit _printFormatUnsigned().
+ * @param end - pointer after the last digit
+ * @param n - number to convert
+ * @param decode base: DEC, HEX, OCT, BIN (2 - 36)
+ * @retval pointer to the first digit
+ */
+char *_printFormatUnsigned64(char *end, uint64_t n, uint8_t base)
+{
+  uint8_t shift = 0;
+  uint64_t q;
+  uint8_t c;
+  char *str;
+
+  if (base == DEC)
+  {
+    while (n > UINT32_MAX)
+    { // at most two 64-bit divisions
+      q = n / 100000000;
+      str = _printFormatUnsigned(end, (uint32_t)(n - q * 100000000), DEC);
+      while (str > (end - 8))
+      {
+        *--str = '0';
+      }
+      end = str;
+      n = q;
+    }
+    return _printFormatUnsigned(end, (uint32_t)n, DEC);
+  }
+  else if ((base & (base - 1)) == 0)
+  { // BIN, OCT, HEX
+    while ((1U << shift) < base)
+    {
+      shift++;
+    }
+    do
+    {
+      c = n & (base - 1);
+      *--end = c < 10 ? c + '0' : c + 'A' - 10;
+      n >>= shift;
+    } while (n);
+  }
+  else
+  {
+    do
+    {
+      q = n / base;
+      c = n - base * q;
+      *--end = c < 10 ? c + '0' : c + 'A' - 10;
+      n = q;
+    } while (n);
+  }
+  return end;
+}
+
+/**
+ * @brief Private function: convert binary fraction (m / 2^shift, < 1) to decimals, rounded to nearest
+ *        (ties to even, same as printf()). All calculations are done on integers, so result is exact.
+ * @param m - fraction numerator (up to 53 bits)
+ * @param shift - fraction denominator exponent (1 - 255)
+ * @param scale - 10^decimals (up to 10^9)
+ * @param int_odd - integer part is odd (for ties to even without decimals, scale = 1)
+ * @retval fraction * scale, rounded. Equals scale if fraction is rounded up to 1.
+ */
+uint32_t _printRoundFraction(uint64_t m, uint8_t shift, uint32_t scale, bool int_odd)
+{
+  // product = m * scale (up to 83 bits), split on high (32 bits) and low (64 bits) part
+  uint64_t lo_prod = (m & 0xFFFFFFFF) * scale;
+  uint64_t hi_prod = (m >> 32) * scale;
+  uint64_t lo = lo_prod + (hi_prod << 32);
+  uint32_t hi = (uint32_t)(hi_prod >> 32) + (lo < lo_prod);
+  uint32_t result;
+  bool round_bit; // bit just below result (0.5)
+  bool sticky;    // any bit below round bit
+
+  if (shift > 96)
+  { // product < 2^83, so result is 0 and round bit is 0
+    return 0;
+  }
+
+  if (shift < 64)
+  {
+    result = (uint32_t)((lo >> shift) | ((uint64_t)hi << (64 - shift)));
+  }
+  else
+  {
+    result = (shift < 96) ? (hi >> (shift - 64)) : 0;
+  }
+  if (shift <= 64)
+  {
+    round_bit = (lo >> (shift - 1)) & 1;
+    sticky = (shift > 1) && ((lo & ((1ULL << (shift - 1)) - 1)) != 0);
+  }
+  else
+  {
+    round_bit = (hi >> (shift - 65)) & 1;
+    sticky = (lo != 0) || ((shift > 65) && ((hi & ((1UL << (shift - 65)) - 1)) != 0));
+  }
+
+  if (round_bit && (sticky || ((scale == 1) ? int_odd : (result & 1))))
+  {
+    result++;
+  }
+  return result;
+}
+
+/**
+ * @brief Private function: send data or put it in output buffer (UART_PRINT_BUFFERED).
+ *        Buffer is sent when it is full or when data contains new line.
+ * @param pointer to a data
+ * @param size of data
+ * @retval None
+ */
+void _printWrite(const char *data, uint16_t size)
+{
+#ifdef UART_PRINT_BUFFERED
+  bool new_line = (memchr(data, '\n', size) != NULL);
+  uint32_t num;
+
+  while (size)
+  {
+    num = ring_buffer_put_partial(&_print_buff, data, size);
+    data += num;
+    size -= num;
+    if (size)
+    { // buffer is full, send it (or wait until transfer makes some space)
+      printFlush();
+    }
+  }
+  if (new_line)
+  {
+    printFlush();
+  }
+#else
+  send_data((uint8_t *)data, size);
+#endif
+}
+
+#if defined(UART_PRINT_BUFFERED) && defined(UART_PRINT_DMA)
+/**
+ * @brief Private function: start send_data_start() transfer of buffered data. Called from printFlush() when
+ *        no transfer is in progress and from printTxComplete() (interrupt) when previous transfer is finished.
+ *        Busy flag is only read and written (no read-modify-write), so no exclusive access instructions or
+ *        atomic library calls are needed (Cortex-M0).
+ * @retval true if transfer was started, false if there is no buffered data
+ */
+bool _printStartTx(void)
+{
+  rb_span_t span[2];
+
+  if (ring_buffer_peek(&_print_buff, span) == 0)
+  {
+    return false;
+  }
+  // only contiguous part, the rest (wrapped over buffer end) is sent in next transfer
+  _print_tx_len = (uint16_t)span[0].num;
+  send_data_start(span[0].data, _print_tx_len);
+  return true;
 }
+#endif
@@ -1,6 +1,6 @@
 /*
  * Template library for creating an Arduino-like UART print API.
- * @date    26-Apr-2020
+ * @date    16-Oct-2026
  * @author  Domen Jurkovic
  * @source  http://damogranlabs.com/
  *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
@@ -11,6 +11,7 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "stdint.h"
+#include "stdbool.h"
 
 #include "uart_print_user.h"
 
@@ -20,13 +21,24 @@
 #define HEX 16
 #define OCT 8
 
+#define PRINT_FLOAT_DECIMALS 6     // number of decimals in printFloat() (same as "%f")
+#define PRINT_FLOAT_MAX_DECIMALS 9 // max number of decimals in printFloatDecimals()
+
 void printString(char *data);                     //send/print string overserial.
 void printStringLn(char *data);                   //send/print string.
 void printNumber(int32_t number, uint8_t base);   //send/print SINGED/UNSIGNED int32_t number
 void printNumberLn(int32_t number, uint8_t base); //send/print SINGED/UNSIGNED number.
-void printFloat(double number);
+void printNumberWidth(int32_t number, uint8_t base, uint8_t width, bool zero_pad); //right-aligned, padded number
+void printNumber64(int64_t number, uint8_t base);   //send/print SINGED/UNSIGNED int64_t number
+void printNumber64Ln(int64_t number, uint8_t base);
+void printFloat(double number);   //send/print float number with PRINT_FLOAT_DECIMALS decimals
 void printFloatLn(double number);
+void printFloatDecimals(double number, uint8_t decimals); //send/print float number with selected number of decimals
+void printFloatDecimalsLn(double number, uint8_t decimals);
 
 void printLn(void); //print new line and carriage return
 
+void printFlush(void);      //send buffered data (UART_PRINT_BUFFERED)
+void printTxComplete(void); //call when send_data_start() transfer is finished (UART_PRINT_DMA)
+
 #endif
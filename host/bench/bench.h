@@ -0,0 +1,82 @@
+/**
+ ******************************************************************************
+ * File Name          : bench.h
+ * Description        : This file provides timing helpers for host (PC) benchmarks
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+ *
+ * Usage:
+ *  bench_t b;
+ *  uint32_t n = bench_iterations(argc, argv, 1000000); // "--quick" argument: 1/1000 of iterations (ctest)
+ *  bench_start(&b);
+ *  for (i = 0; i < n; i++) { ... }
+ *  bench_stop(&b, n, "operation");
+ * Time per operation is printed in ns and in time stamp counter ticks (x86 only, approximately CPU cycles).
+ */
+
+#ifndef __BENCH_H
+#define __BENCH_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+typedef struct
+{
+  struct timespec ts;
+  uint64_t tsc;
+} bench_t;
+
+static inline uint64_t _bench_tsc(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#else
+  return 0;
+#endif
+}
+
+static inline uint32_t bench_iterations(int argc, char *argv[], uint32_t iterations)
+{
+  if ((argc > 1) && (strcmp(argv[1], "--quick") == 0))
+  {
+    iterations /= 1000;
+    if (iterations == 0)
+    {
+      iterations = 1;
+    }
+  }
+  return iterations;
+}
+
+static inline void bench_start(bench_t *b)
+{
+  clock_gettime(CLOCK_MONOTONIC, &b->ts);
+  b->tsc = _bench_tsc();
+}
+
+// Print time per operation, returns ns per operation
+static inline double bench_stop(bench_t *b, uint64_t ops, const char *name)
+{
+  struct timespec now;
+  uint64_t tsc = _bench_tsc();
+  double ns;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  ns = (double)(now.tv_sec - b->ts.tv_sec) * 1e9 + (double)(now.tv_nsec - b->ts.tv_nsec);
+  if (ops == 0)
+  {
+    ops = 1;
+  }
+  printf("%-48s %10.2f ns/op %10.1f tsc/op\n", name, ns / (double)ops, (double)(tsc - b->tsc) / (double)ops);
+  return ns / (double)ops;
+}
+
+#endif /* __BENCH_H */
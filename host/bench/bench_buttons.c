@@ -0,0 +1,63 @@
+/**
+ ******************************************************************************
+ * File Name          : bench_buttons.c
+ * Description        : This file provides buttons benchmarks (host build)
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "bench.h"
+#include "buttons.h"
+#include "host.h"
+
+// NUM_OF_BUTTONS is set by build, buttons are on port A pins 0 ... 31 and port B pins 0 ... 31
+static button_t _bench_buttons[NUM_OF_BUTTONS];
+
+int main(int argc, char *argv[])
+{
+  uint32_t n = bench_iterations(argc, argv, 200000);
+  char name[64];
+  bench_t b;
+  uint32_t i;
+
+  host_reset();
+  host_gpio_a.idr = 0xFFFFFFFF; // all released (active low)
+  host_gpio_b.idr = 0xFFFFFFFF;
+  for (i = 0; i < NUM_OF_BUTTONS; i++)
+  {
+    btn_register(_bench_buttons, (i < 32) ? &host_gpio_a : &host_gpio_b, HOST_PIN(i % 32),
+                 (btn_press_mode_t)(i % 3));
+  }
+
+  // idle buttons: only pin reads
+  snprintf(name, sizeof(name), "btn_handle, %d idle buttons", NUM_OF_BUTTONS);
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    host_advance_us(1000);
+    btn_handle(_bench_buttons);
+  }
+  bench_stop(&b, n, name);
+
+  // all buttons pressed and released every 100 ms: debounce, press, longpress, repetitive and release paths
+  snprintf(name, sizeof(name), "btn_handle, %d toggling buttons", NUM_OF_BUTTONS);
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    host_gpio_a.idr = ((i / 100) & 0x01) ? 0xFFFFFFFF : 0;
+    host_gpio_b.idr = host_gpio_a.idr;
+    host_advance_us(1000);
+    btn_handle(_bench_buttons);
+  }
+  bench_stop(&b, n, name);
+  printf("events: %u press, %u longpress, %u release\n", (unsigned)host_btn_events.press,
+         (unsigned)host_btn_events.longpress, (unsigned)host_btn_events.release);
+
+  return 0;
+}
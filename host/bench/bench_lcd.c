@@ -0,0 +1,270 @@
+/**
+ ******************************************************************************
+ * File Name          : bench_lcd.c
+ * Description        : This file provides HD44780 LCD command generation benchmarks (host build)
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+ *
+ * CPU time of LCD functions (blocking delays only advance simulated time), with number of pin writes,
+ * I2C bytes and simulated bus time per call. In LCD_ASYNC mode, queue is drained with lcd_task() after each call,
+ * and main loop stall (longest lcd_task() call) is measured.
+ * With LCD_USE_BUSY_FLAG, HD44780 model is connected to answer busy flag reads (its CPU time is included).
+ * Number formatting alone (without LCD output) is compared with snprintf().
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "bench.h"
+#include "hd44780.h"
+#include "host.h"
+#include "lcd.h"
+
+// private function of lcd.c
+void _lcd_format_number(char *buf, bool negative, uint32_t int_part, uint32_t frac_part, uint8_t decimals,
+                        uint8_t width, bool zero_pad);
+
+static lcd_bus_t _bench_bus = {
+    .d = {{&host_gpio_b, HOST_PIN(0)}, {&host_gpio_b, HOST_PIN(1)}, {&host_gpio_b, HOST_PIN(2)},
+          {&host_gpio_b, HOST_PIN(3)}, {&host_gpio_b, HOST_PIN(4)}, {&host_gpio_b, HOST_PIN(5)},
+          {&host_gpio_b, HOST_PIN(6)}, {&host_gpio_b, HOST_PIN(7)}},
+    .rs = {&host_gpio_a, HOST_LCD_RS_PIN},
+    .rw = {&host_gpio_a, HOST_LCD_RW_PIN}};
+static lcd_t _bench_lcd = {.bus = &_bench_bus, .e = {&host_gpio_a, HOST_LCD_E_PIN}};
+#ifdef LCD_USE_BUSY_FLAG
+static hd44780_t _bench_model;
+#endif
+
+static const char *_bench_options =
+#ifdef LCD_8BIT_MODE
+    " LCD_8BIT_MODE"
+#endif
+#ifdef LCD_USE_PORT_WRITE
+    " LCD_USE_PORT_WRITE"
+#endif
+#ifdef LCD_USE_FRAMEBUFFER
+    " LCD_USE_FRAMEBUFFER"
+#endif
+#ifdef LCD_ASYNC
+    " LCD_ASYNC"
+#endif
+#ifdef LCD_USE_PCF8574
+    " LCD_USE_PCF8574"
+#endif
+#ifdef LCD_USE_BUSY_FLAG
+    " LCD_USE_BUSY_FLAG"
+#endif
+    "";
+
+// Send everything that is queued (LCD_ASYNC), as main loop would
+void bench_lcd_sync(void)
+{
+#ifdef LCD_ASYNC
+  uint32_t elapsed_us;
+
+  while (lcd_is_busy(&_bench_lcd))
+  { // jump to the next step deadline, so that each lcd_task() call sends something (no idle calls are measured)
+    elapsed_us = lcd_get_us() - _bench_lcd.async.timestamp;
+    if (elapsed_us < _bench_lcd.async.wait_us)
+    {
+      host_advance_us(_bench_lcd.async.wait_us - elapsed_us);
+    }
+    lcd_task(&_bench_lcd);
+  }
+#endif
+}
+
+void bench_op_print_str(uint32_t i)
+{
+  lcd_print_str(&_bench_lcd, 0, 0, (i & 0x01) ? "0123456789ABCDEFGHIJ" : "abcdefghijklmnopqrst");
+  lcd_refresh(&_bench_lcd);
+}
+
+void bench_op_print_int(uint32_t i)
+{
+  lcd_print_int_width(&_bench_lcd, 1, 0, (int32_t)(i * 2654435761u), 11, false);
+  lcd_refresh(&_bench_lcd);
+}
+
+void bench_op_print_float(uint32_t i)
+{
+  lcd_print_float_width(&_bench_lcd, 1, 12, (float)i / 8.0f, 2, 8, false);
+  lcd_refresh(&_bench_lcd);
+}
+
+void bench_op_print_char(uint32_t i)
+{
+  lcd_print_str(&_bench_lcd, 2, 5, (i & 0x01) ? "x" : "y");
+  lcd_refresh(&_bench_lcd);
+}
+
+void bench_op_clear(uint32_t i)
+{
+  (void)i;
+  lcd_clear(&_bench_lcd);
+  lcd_refresh(&_bench_lcd);
+}
+
+void bench_lcd_run(const char *name, void (*op)(uint32_t i), uint32_t n)
+{
+  host_lcd_stats_t stats = host_lcd_stats;
+  uint32_t i2c_bytes = host_i2c.bytes;
+  uint64_t time_us = host_time_us();
+  bench_t b;
+  uint32_t i;
+
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    op(i);
+    bench_lcd_sync();
+  }
+  bench_stop(&b, n, name);
+  printf("%-48s %10.1f pin writes %6.1f I2C bytes %8.1f us bus time\n", "",
+         (double)(host_lcd_stats.pin_writes - stats.pin_writes) / n, (double)(host_i2c.bytes - i2c_bytes) / n,
+         (double)(host_time_us() - time_us) / n);
+}
+
+// Formatting only: built-in formatter vs snprintf(), same numbers as bench_op_print_int/float()
+void bench_format(uint32_t n)
+{
+  char buf[24];
+  uint32_t checksum = 0; // result is used, so that formatting is not optimized away
+  int32_t num;
+  float fnum;
+  uint32_t abs_num, int_part, frac_part;
+  bench_t b;
+  uint32_t i;
+
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    snprintf(buf, sizeof(buf), "%11ld", (long)(int32_t)(i * 2654435761u));
+    checksum += (uint8_t)buf[10];
+  }
+  bench_stop(&b, n, "snprintf %11ld");
+
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    num = (int32_t)(i * 2654435761u);
+    abs_num = (num < 0) ? (0 - (uint32_t)num) : (uint32_t)num;
+    _lcd_format_number(buf, (num < 0), abs_num, 0, 0, 11, false);
+    checksum += (uint8_t)buf[10];
+  }
+  bench_stop(&b, n, "lcd formatter, int width 11");
+
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    snprintf(buf, sizeof(buf), "%8.2f", (double)((float)i / 8.0f));
+    checksum += (uint8_t)buf[7];
+  }
+  bench_stop(&b, n, "snprintf %8.2f");
+
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  { // float is split the same way as in lcd_print_float_width()
+    fnum = (float)i / 8.0f;
+    int_part = (uint32_t)fnum;
+    frac_part = (uint32_t)((fnum - (float)int_part) * 100.0f + 0.5f);
+    if (frac_part >= 100)
+    {
+      frac_part -= 100;
+      int_part++;
+    }
+    _lcd_format_number(buf, false, int_part, frac_part, 2, 8, false);
+    checksum += (uint8_t)buf[7];
+  }
+  bench_stop(&b, n, "lcd formatter, float 8.2");
+  printf("%-48s %10u checksum\n", "", (unsigned)checksum);
+}
+
+// Main loop (LCD_ASYNC): other work takes 1 us between lcd_task() calls, the longest lcd_task() call is the main
+// loop stall caused by LCD. Each iteration prints 20 characters, every 16th iteration clears LCD first.
+// Call times are collected in 100 ns histogram buckets: 99.9th percentile excludes preemption of benchmark.
+#ifdef LCD_ASYNC
+#define BENCH_CALL_BUCKET_NS 100
+#define BENCH_CALL_BUCKETS 1000 // last bucket: 100 us or more
+static uint32_t _bench_call_hist[BENCH_CALL_BUCKETS];
+#endif
+
+void bench_main_loop(uint32_t n)
+{
+#ifdef LCD_ASYNC
+  struct timespec start, end;
+  uint64_t call_ns;
+  uint64_t max_call_ns = 0;
+  uint64_t calls = 0;
+  uint64_t sum = 0;
+  uint32_t bucket;
+  bench_t b;
+  uint32_t i;
+
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    if ((i & 0x0F) == 0)
+    {
+      lcd_clear(&_bench_lcd);
+    }
+    bench_op_print_str(i);
+    while (lcd_is_busy(&_bench_lcd))
+    {
+      host_advance_us(1);
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      lcd_task(&_bench_lcd);
+      clock_gettime(CLOCK_MONOTONIC, &end);
+      call_ns = (uint64_t)(end.tv_sec - start.tv_sec) * 1000000000u + end.tv_nsec - start.tv_nsec;
+      if (call_ns > max_call_ns)
+      {
+        max_call_ns = call_ns;
+      }
+      bucket = (call_ns / BENCH_CALL_BUCKET_NS < BENCH_CALL_BUCKETS) ? (call_ns / BENCH_CALL_BUCKET_NS)
+                                                                      : (BENCH_CALL_BUCKETS - 1);
+      _bench_call_hist[bucket]++;
+      calls++;
+    }
+  }
+  bench_stop(&b, calls, "lcd_task main loop, 1 us between calls");
+
+  for (bucket = 0; bucket < (BENCH_CALL_BUCKETS - 1); bucket++)
+  {
+    sum += _bench_call_hist[bucket];
+    if (sum * 1000 >= calls * 999)
+    {
+      break;
+    }
+  }
+  printf("%-48s %10.2f us lcd_task() call, 99.9th percentile (max %.2f us)\n", "",
+         (double)((bucket + 1) * BENCH_CALL_BUCKET_NS) / 1000.0, (double)max_call_ns / 1000.0);
+#else
+  (void)n;
+#endif
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t n = bench_iterations(argc, argv, 200000);
+
+  printf("lcd 4x20,%s\n", _bench_options[0] ? _bench_options : " default options");
+  host_reset();
+#ifdef LCD_USE_BUSY_FLAG
+  hd44780_attach(&_bench_model, HOST_LCD_E_PIN);
+#endif
+  lcd_init(&_bench_lcd, 4, 20);
+  bench_lcd_sync();
+
+  bench_lcd_run("lcd_print_str 20 characters", bench_op_print_str, n);
+  bench_lcd_run("lcd_print_str 1 character", bench_op_print_char, n);
+  bench_lcd_run("lcd_print_int_width 11", bench_op_print_int, n);
+  bench_lcd_run("lcd_print_float_width 8.2", bench_op_print_float, n);
+  bench_lcd_run("lcd_clear", bench_op_clear, n / 10);
+  bench_format(n);
+  bench_main_loop(n / 100);
+
+  return 0;
+}
@@ -0,0 +1,232 @@
+/**
+ ******************************************************************************
+ * File Name          : bench_ring_buffer.c
+ * Description        : This file provides ring buffer benchmarks (host build)
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+ *
+ * Baseline: copy of the original ring buffer put/get (shared element counter, index reset on wrap-around), so that
+ * current implementation can be compared with it on the same machine.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+#include "ring_buffer.h"
+
+#define BENCH_RB_SIZE 256 // power of two, valid in both index modes
+#define BENCH_BLOCK_SIZE 16
+#define BENCH_FLUSH_MAX_SIZE 65536
+
+RING_BUFFER_DEFINE(bench_rb, BENCH_RB_SIZE);
+
+// Original (count based) ring buffer descriptor
+typedef struct
+{
+  uint8_t *buff;
+  uint32_t n_elem;
+  uint32_t head;
+  uint32_t tail;
+  uint32_t count;
+  rb_status_t status;
+} volatile bench_rb_count_t;
+
+uint8_t bench_rb_count_buff[BENCH_RB_SIZE];
+bench_rb_count_t bench_rb_count = {.buff = bench_rb_count_buff, .n_elem = BENCH_RB_SIZE};
+
+// Original ring_buffer_put()
+__attribute__((noinline)) rb_status_t bench_count_put(bench_rb_count_t *rbd, uint8_t *data, uint32_t num)
+{
+  rb_status_t status = RB_ERROR;
+  uint32_t num_to_end = 0;
+
+  if (rbd != NULL)
+  {
+    if ((rbd->n_elem - rbd->count) >= num)
+    {
+      if (rbd->head >= rbd->n_elem)
+      {
+        rbd->head = 0;
+      }
+
+      num_to_end = rbd->n_elem - rbd->head;
+      if (num_to_end < num)
+      {
+        memcpy(&(rbd->buff[rbd->head]), data, num_to_end);
+        memcpy(rbd->buff, (data + num_to_end), (num - num_to_end));
+
+        rbd->head = num - num_to_end;
+        rbd->count = rbd->count + num;
+      }
+      else
+      {
+        memcpy(&(rbd->buff[rbd->head]), data, num);
+
+        rbd->head = rbd->head + num;
+        rbd->count = rbd->count + num;
+      }
+
+      status = RB_OK;
+    }
+    else
+    {
+      status = RB_NOT_ENOUGH_SPACE;
+    }
+  }
+  rbd->status = status;
+  return status;
+}
+
+// Original ring_buffer_get()
+__attribute__((noinline)) rb_status_t bench_count_get(bench_rb_count_t *rbd, uint8_t *data, uint32_t num)
+{
+  rb_status_t status = RB_ERROR;
+  uint32_t num_to_end = 0;
+
+  if (rbd != NULL)
+  {
+    if (rbd->count >= num)
+    {
+      if (rbd->tail >= rbd->n_elem)
+      {
+        rbd->tail = 0;
+      }
+
+      num_to_end = rbd->n_elem - rbd->tail;
+      if (num >= num_to_end)
+      {
+        memcpy(data, &(rbd->buff[rbd->tail]), num_to_end);
+        memcpy(data + num_to_end, rbd->buff, (num - num_to_end));
+
+        rbd->tail = num - num_to_end;
+        rbd->count = rbd->count - num;
+      }
+      else
+      {
+        memcpy(data, &(rbd->buff[rbd->tail]), num);
+
+        rbd->tail = rbd->tail + num;
+        rbd->count = rbd->count - num;
+      }
+      status = RB_OK;
+    }
+    else
+    {
+      status = RB_NOT_ENOUGH_DATA;
+    }
+  }
+
+  rbd->status = status;
+  return status;
+}
+
+// Byte by byte put/get (for example, UART RX interrupt -> main loop)
+void bench_put_get_byte(uint32_t n)
+{
+  bench_t b;
+  uint8_t data = 0;
+  uint32_t i;
+
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    ring_buffer_put(&bench_rb, &data, 1);
+    ring_buffer_get(&bench_rb, &data, 1);
+  }
+  bench_stop(&b, 2 * (uint64_t)n, "ring_buffer_put/get 1 byte");
+
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    bench_count_put(&bench_rb_count, &data, 1);
+    bench_count_get(&bench_rb_count, &data, 1);
+  }
+  bench_stop(&b, 2 * (uint64_t)n, "baseline (count) put/get 1 byte");
+}
+
+// Block put/get, buffer half full so that copies wrap over buffer end
+void bench_put_get_block(uint32_t n)
+{
+  bench_t b;
+  uint8_t data[BENCH_BLOCK_SIZE] = {0};
+  uint8_t fill[BENCH_RB_SIZE / 2] = {0};
+  uint32_t i;
+
+  ring_buffer_flush(&bench_rb);
+  ring_buffer_put(&bench_rb, fill, sizeof(fill));
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    ring_buffer_put(&bench_rb, data, sizeof(data));
+    ring_buffer_get(&bench_rb, data, sizeof(data));
+  }
+  bench_stop(&b, 2 * (uint64_t)n, "ring_buffer_put/get 16 bytes");
+  ring_buffer_flush(&bench_rb);
+
+  bench_count_put(&bench_rb_count, fill, sizeof(fill));
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    bench_count_put(&bench_rb_count, data, sizeof(data));
+    bench_count_get(&bench_rb_count, data, sizeof(data));
+  }
+  bench_stop(&b, 2 * (uint64_t)n, "baseline (count) put/get 16 bytes");
+  bench_count_get(&bench_rb_count, fill, sizeof(fill));
+}
+
+// Flush (indexes only) and wipe (indexes and memory) of half full buffers of different sizes
+void bench_flush(uint32_t n)
+{
+  static uint8_t storage[BENCH_FLUSH_MAX_SIZE];
+  const uint32_t sizes[] = {16, 256, 4096, BENCH_FLUSH_MAX_SIZE};
+  char name[48];
+  rb_att_t rb;
+  bench_t b;
+  uint32_t s, i, wipes;
+
+  for (s = 0; s < (sizeof(sizes) / sizeof(sizes[0])); s++)
+  {
+    ring_buffer_init_static(&rb, storage, sizes[s]);
+
+    ring_buffer_put_partial(&rb, storage, sizes[s] / 2);
+    bench_start(&b);
+    for (i = 0; i < n; i++)
+    {
+      ring_buffer_flush(&rb);
+    }
+    snprintf(name, sizeof(name), "ring_buffer_flush, size %u", (unsigned)sizes[s]);
+    bench_stop(&b, n, name);
+
+    // keep total number of cleared bytes the same for all sizes
+    wipes = (n / sizes[s]) ? (n / sizes[s]) : 1;
+    ring_buffer_put_partial(&rb, storage, sizes[s] / 2);
+    bench_start(&b);
+    for (i = 0; i < wipes; i++)
+    {
+      ring_buffer_wipe(&rb);
+    }
+    snprintf(name, sizeof(name), "ring_buffer_wipe, size %u", (unsigned)sizes[s]);
+    bench_stop(&b, wipes, name);
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t n = bench_iterations(argc, argv, 20000000);
+
+#ifdef RB_POWER_OF_TWO_SIZE
+  printf("ring_buffer (RB_POWER_OF_TWO_SIZE), size %d\n", BENCH_RB_SIZE);
+#else
+  printf("ring_buffer, size %d\n", BENCH_RB_SIZE);
+#endif
+  bench_put_get_byte(n);
+  bench_put_get_block(n / 4);
+  bench_flush(n);
+
+  return 0;
+}
@@ -0,0 +1,45 @@
+/**
+ ******************************************************************************
+ * File Name          : bench_rot_enc.c
+ * Description        : This file provides rotary encoder benchmarks (host build)
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "bench.h"
+#include "host.h"
+#include "rot_enc.h"
+
+#define ENC_A_PIN HOST_PIN(0)
+#define ENC_B_PIN HOST_PIN(1)
+
+// Quadrature sequence of one detent (A, B), pin A interrupt calls rot_enc_update() on each A edge
+static const uint32_t _bench_cw_steps[4] = {0, ENC_B_PIN, ENC_A_PIN | ENC_B_PIN, ENC_A_PIN};
+
+int main(int argc, char *argv[])
+{
+  uint32_t n = bench_iterations(argc, argv, 20000000);
+  rot_enc_data_t encoder;
+  bench_t b;
+  uint32_t i;
+
+  host_reset();
+  rot_enc_init(&encoder, &host_gpio_a, ENC_A_PIN, &host_gpio_a, ENC_B_PIN);
+
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    host_gpio_a.idr = _bench_cw_steps[i & 0x03];
+    rot_enc_update(&encoder);
+  }
+  bench_stop(&b, n, "rot_enc_update");
+  printf("absolute count after %u updates: %d\n", (unsigned)n, (int)rot_enc_get_abs_count(&encoder));
+
+  return 0;
+}
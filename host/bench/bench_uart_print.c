@@ -0,0 +1,143 @@
+/**
+ ******************************************************************************
+ * File Name          : bench_uart_print.c
+ * Description        : This file provides UART print benchmarks (host build)
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "bench.h"
+#include "host.h"
+#include "uart_print.h"
+
+// Previous printNumber(): one division per digit
+void bench_print_number_div(int32_t number, uint8_t base)
+{
+  char buf[8 * sizeof(int32_t) + 2]; // sign, digits and '\0'
+  char *str = &buf[sizeof(buf) - 1];
+  uint32_t n = (number < 0) ? (0U - (uint32_t)number) : (uint32_t)number;
+  uint32_t m;
+  char c;
+
+  *str = '\0';
+  do
+  {
+    m = n;
+    n /= base;
+    c = m - base * n;
+    *--str = c < 10 ? c + '0' : c + 'A' - 10;
+  } while (n);
+  if (number < 0)
+  {
+    *--str = '-';
+  }
+  printString(str);
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t n = bench_iterations(argc, argv, 2000000);
+  bench_t b;
+  char str[32];
+  uint32_t i;
+
+  host_reset();
+#ifdef UART_PRINT_BUFFERED
+#ifdef UART_PRINT_DMA
+  printf("uart_print (UART_PRINT_BUFFERED, UART_PRINT_DMA)\n");
+#else
+  printf("uart_print (UART_PRINT_BUFFERED)\n");
+#endif
+#else
+  printf("uart_print\n");
+#endif
+
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    printNumber((int32_t)(i * 2654435761u), DEC);
+  }
+  bench_stop(&b, n, "printNumber DEC, random int32_t");
+
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    bench_print_number_div((int32_t)(i * 2654435761u), DEC);
+  }
+  bench_stop(&b, n, "divide loop DEC, random int32_t");
+
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    printNumber((int32_t)(i & 0xFF), DEC);
+  }
+  bench_stop(&b, n, "printNumber DEC, 0 - 255");
+
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    bench_print_number_div((int32_t)(i & 0xFF), DEC);
+  }
+  bench_stop(&b, n, "divide loop DEC, 0 - 255");
+
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    printNumber((int32_t)(i * 2654435761u), HEX);
+  }
+  bench_stop(&b, n, "printNumber HEX, random int32_t");
+
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    bench_print_number_div((int32_t)(i * 2654435761u), HEX);
+  }
+  bench_stop(&b, n, "divide loop HEX, random int32_t");
+
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    printNumber64((int64_t)i * 11400714819323198485ull, DEC);
+  }
+  bench_stop(&b, n, "printNumber64 DEC, random int64_t");
+
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    printFloat((double)(int32_t)(i * 2654435761u) / 1000.0);
+  }
+  bench_stop(&b, n, "printFloat, +-2147483.647");
+
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    printFloatDecimals((double)i / 64.0, 2);
+  }
+  bench_stop(&b, n, "printFloatDecimals 2 decimals");
+
+  // C library reference (formatting only, nothing is sent)
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    snprintf(str, sizeof(str), "%f", (double)(int32_t)(i * 2654435761u) / 1000.0);
+  }
+  bench_stop(&b, n, "snprintf \"%f\", +-2147483.647");
+
+  bench_start(&b);
+  for (i = 0; i < n; i++)
+  {
+    snprintf(str, sizeof(str), "%.2f", (double)i / 64.0);
+  }
+  bench_stop(&b, n, "snprintf \"%.2f\"");
+
+  printFlush();
+  printf("%u bytes sent in %u send calls\n", (unsigned)host_uart.len, (unsigned)host_uart.calls);
+
+  return 0;
+}
@@ -0,0 +1,88 @@
+/**
+ ******************************************************************************
+ * File Name          : test.h
+ * Description        : This file provides assertion helpers for host (PC) tests
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+ *
+ * Usage (one test executable per source file):
+ *  void test_something(void)
+ *  {
+ *    TEST_ASSERT(ring_buffer_empty(&rb) == RB_EMPTY);
+ *    TEST_ASSERT_EQ(ring_buffer_size(&rb), 0);
+ *    TEST_ASSERT_STR(str, "expected");
+ *  }
+ *  int main(void)
+ *  {
+ *    TEST_RUN(test_something);
+ *    return TEST_RESULT();
+ *  }
+ * Failed assertions are printed (file, line, values) and counted, test continues.
+ */
+
+#ifndef __TEST_H
+#define __TEST_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+static uint32_t _test_checks;
+static uint32_t _test_failures;
+
+#define TEST_ASSERT(cond)                                                                                       \
+  do                                                                                                            \
+  {                                                                                                             \
+    _test_checks++;                                                                                             \
+    if (!(cond))                                                                                                \
+    {                                                                                                           \
+      _test_failures++;                                                                                         \
+      printf("%s:%d: %s: assertion failed: %s\n", __FILE__, __LINE__, __func__, #cond);                         \
+    }                                                                                                           \
+  } while (0)
+
+// integer values, compared as long long
+#define TEST_ASSERT_EQ(actual, expected)                                                                        \
+  do                                                                                                            \
+  {                                                                                                             \
+    long long _actual = (long long)(actual);                                                                    \
+    long long _expected = (long long)(expected);                                                                \
+    _test_checks++;                                                                                             \
+    if (_actual != _expected)                                                                                   \
+    {                                                                                                           \
+      _test_failures++;                                                                                         \
+      printf("%s:%d: %s: %s == %lld, expected %lld\n", __FILE__, __LINE__, __func__, #actual, _actual,          \
+             _expected);                                                                                        \
+    }                                                                                                           \
+  } while (0)
+
+#define TEST_ASSERT_STR(actual, expected)                                                                       \
+  do                                                                                                            \
+  {                                                                                                             \
+    const char *_actual = (actual);                                                                             \
+    const char *_expected = (expected);                                                                         \
+    _test_checks++;                                                                                             \
+    if (strcmp(_actual, _expected) != 0)                                                                        \
+    {                                                                                                           \
+      _test_failures++;                                                                                         \
+      printf("%s:%d: %s: %s == \"%s\", expected \"%s\"\n", __FILE__, __LINE__, __func__, #actual, _actual,      \
+             _expected);                                                                                        \
+    }                                                                                                           \
+  } while (0)
+
+#define TEST_RUN(test)                                                                                          \
+  do                                                                                                            \
+  {                                                                                                             \
+    uint32_t _failures = _test_failures;                                                                        \
+    test();                                                                                                     \
+    printf("%-48s %s\n", #test, (_test_failures == _failures) ? "ok" : "FAILED");                               \
+  } while (0)
+
+// Print summary, returns exit code of test executable
+#define TEST_RESULT()                                                                                           \
+  (printf("%u checks, %u failures\n", (unsigned)_test_checks, (unsigned)_test_failures), (_test_failures != 0))
+
+#endif /* __TEST_H */
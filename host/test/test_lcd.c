@@ -0,0 +1,563 @@
+/**
+ ******************************************************************************
+ * File Name          : test_lcd.c
+ * Description        : This file provides HD44780 LCD library tests (host build)
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+ *
+ * LCD functions drive HD44780 model (host/user/hd44780.c), tests check displayed characters, CGRAM and
+ * timing errors reported by model. Built for all valid option combinations.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test_lcd.h"
+
+void test_init(void)
+{
+  test_lcd_setup();
+
+#ifdef LCD_8BIT_MODE
+  TEST_ASSERT(test_model.eight_bit);
+#else
+  TEST_ASSERT(!test_model.eight_bit);
+#endif
+  TEST_ASSERT(test_model.two_line);
+  TEST_ASSERT_EQ(test_model.display_ctrl, 0x04); // display on, no cursor, no blinking
+  TEST_ASSERT_EQ(test_model.entry_mode, 0x02);   // increment, no display shift
+  TEST_ASSERT_EQ(test_model.ac, 0);
+#ifdef LCD_USE_PCF8574
+  TEST_ASSERT(test_model.backlight);
+#endif
+  TEST_LCD_ASSERT_ROW(&test_model, 0, "                    ");
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+void test_print_str(void)
+{
+  test_lcd_setup();
+
+  lcd_print_str(&test_lcd, 0, 0, "Hello");
+  lcd_print_str(&test_lcd, 2, 5, "abc");
+  lcd_print_str(&test_lcd, 3, 15, "World");
+  test_lcd_sync(&test_lcd);
+
+  TEST_LCD_ASSERT_ROW(&test_model, 0, "Hello               ");
+  TEST_LCD_ASSERT_ROW(&test_model, 1, "                    ");
+  TEST_LCD_ASSERT_ROW(&test_model, 2, "     abc            ");
+  TEST_LCD_ASSERT_ROW(&test_model, 3, "               World");
+  TEST_ASSERT_EQ(test_model.op_data, 13);
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+void test_print_numbers(void)
+{
+  test_lcd_setup();
+
+  lcd_print_int_width(&test_lcd, 1, 0, -42, 5, false);
+  lcd_print_float_width(&test_lcd, 1, 6, 3.14159f, 2, 6, false);
+  lcd_print_int(&test_lcd, 1, 13, 12345);
+  lcd_print_fixed(&test_lcd, 2, 0, -5, 2, 6, true);
+  test_lcd_sync(&test_lcd);
+
+  TEST_LCD_ASSERT_ROW(&test_model, 1, "  -42   3.14 12345  ");
+  TEST_LCD_ASSERT_ROW(&test_model, 2, "-00.05              ");
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+#ifdef LCD_GO_TO_NEW_LINE_IF_STRING_TOO_LONG
+void test_print_str_new_line(void)
+{
+  test_lcd_setup();
+
+  lcd_print_str(&test_lcd, 0, 15, "ABCDEFGH");
+  test_lcd_sync(&test_lcd);
+
+  TEST_LCD_ASSERT_ROW(&test_model, 0, "               ABCDE");
+  TEST_LCD_ASSERT_ROW(&test_model, 1, "FGH                 ");
+  TEST_LCD_ASSERT_ROW(&test_model, 2, "                    ");
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+#endif
+
+void test_clear(void)
+{
+  test_lcd_setup();
+
+  lcd_print_str(&test_lcd, 0, 0, "Hello");
+  lcd_print_str(&test_lcd, 3, 0, "World");
+  test_lcd_sync(&test_lcd);
+  lcd_clear(&test_lcd);
+  test_lcd_sync(&test_lcd);
+
+  TEST_LCD_ASSERT_ROW(&test_model, 0, "                    ");
+  TEST_LCD_ASSERT_ROW(&test_model, 3, "                    ");
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+// Framebuffer: only changed characters are sent, otherwise each print sends all characters
+void test_refresh_changed_only(void)
+{
+  test_lcd_setup();
+
+  lcd_print_str(&test_lcd, 1, 0, "0123456789");
+  test_lcd_sync(&test_lcd);
+  hd44780_op_start(&test_model);
+  lcd_print_str(&test_lcd, 1, 0, "01234x6789");
+  test_lcd_sync(&test_lcd);
+
+  TEST_LCD_ASSERT_ROW(&test_model, 1, "01234x6789          ");
+#ifdef LCD_USE_FRAMEBUFFER
+  TEST_ASSERT_EQ(test_model.op_data, 1);
+  TEST_ASSERT_EQ(test_model.op_commands, 1); // DDRAM address
+#else
+  TEST_ASSERT_EQ(test_model.op_data, 10);
+#endif
+
+  // nothing changed
+  hd44780_op_start(&test_model);
+  test_lcd_sync(&test_lcd);
+#ifdef LCD_USE_FRAMEBUFFER
+  TEST_ASSERT_EQ(test_model.op_data + test_model.op_commands, 0);
+#endif
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+// Asynchronous mode: LCD functions only queue transfers, lcd_task() sends them
+void test_async(void)
+{
+  test_lcd_setup();
+
+  lcd_print_str(&test_lcd, 0, 0, "Async");
+  lcd_refresh(&test_lcd);
+#ifdef LCD_ASYNC
+  TEST_ASSERT(lcd_is_busy(&test_lcd));
+  TEST_ASSERT_EQ(test_model.op_data, 0);
+  lcd_task(&test_lcd); // first step only: E pulse is started
+  TEST_ASSERT(lcd_is_busy(&test_lcd));
+  TEST_ASSERT_EQ(test_model.op_data + test_model.op_commands, 0);
+#else
+  TEST_ASSERT(!lcd_is_busy(&test_lcd));
+  TEST_ASSERT_EQ(test_model.op_data, 5);
+#endif
+  test_lcd_sync(&test_lcd);
+
+  TEST_ASSERT(!lcd_is_busy(&test_lcd));
+  TEST_LCD_ASSERT_ROW(&test_model, 0, "Async               ");
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+// Busy flag: LCD is polled instead of fixed delays, fixed delays are used if busy flag can't be read
+void test_busy_flag(void)
+{
+  test_lcd_setup();
+
+  lcd_print_str(&test_lcd, 0, 0, "01234567890123456789");
+  test_lcd_sync(&test_lcd);
+  TEST_LCD_ASSERT_ROW(&test_model, 0, "01234567890123456789");
+  TEST_ASSERT_EQ(test_model.errors, 0);
+
+#ifdef LCD_USE_BUSY_FLAG
+  TEST_ASSERT(test_lcd.busy_flag_valid);
+  TEST_ASSERT(hd44780_op_bus_time_us(&test_model) < 20 * 100); // fixed delay: 100 us per character
+
+  // R/W is not connected: D7 (busy flag) reads high
+  hd44780_detach_all();
+  host_gpio_b.idr = 0xFF;
+  lcd_print_str(&test_lcd, 1, 0, "x");
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT(!test_lcd.busy_flag_valid);
+#endif
+}
+
+// Glyph cache: glyphs are uploaded to CGRAM when used, resident glyphs are not uploaded again
+void test_glyph_cache(void)
+{
+#ifdef LCD_USE_GLYPH_CACHE
+  static uint8_t bitmaps[9][8];
+  char str[3] = {LCD_GLYPH_ESC, 0, '\0'};
+  uint8_t id, slot, i;
+
+  test_lcd_setup();
+
+  for (id = 1; id <= 9; id++)
+  {
+    for (i = 0; i < 8; i++)
+    {
+      bitmaps[id - 1][i] = (id * 8 + i) & 0x1F;
+    }
+    TEST_ASSERT(lcd_glyph_register(&test_lcd, id, bitmaps[id - 1]));
+  }
+
+  for (id = 1; id <= 9; id++)
+  { // 9th glyph replaces least recently used one
+    str[1] = (char)id;
+    lcd_print_str(&test_lcd, 0, id, str);
+    test_lcd_sync(&test_lcd);
+
+    slot = hd44780_char_at(&test_model, 0, id);
+    TEST_ASSERT(slot < 8);
+    TEST_ASSERT(memcmp(&test_model.cgram[slot * 8], bitmaps[id - 1], 8) == 0);
+  }
+
+  hd44780_op_start(&test_model);
+  lcd_put_glyph(&test_lcd, 3, 0, 9);
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 3, 0), hd44780_char_at(&test_model, 0, 9));
+  TEST_ASSERT_EQ(test_model.op_data, 1);
+  TEST_ASSERT_EQ(test_model.op_commands, 1);
+
+  // unknown glyph
+  lcd_print_str(&test_lcd, 3, 1, "\x1B\x0F");
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 3, 1), '?');
+  TEST_ASSERT_EQ(test_model.errors, 0);
+#else
+  TEST_ASSERT(!lcd_glyph_register(&test_lcd, 1, NULL));
+#endif
+}
+
+void test_create_char(void)
+{
+  uint8_t bitmap[8] = {0x0F, 0x13, 0x11, 0x11, 0x0E, 0x00, 0x00, 0x00};
+
+  test_lcd_setup();
+
+  lcd_create_char(&test_lcd, 3, bitmap);
+  lcd_put_char(&test_lcd, 1, 4, 3);
+  test_lcd_sync(&test_lcd);
+
+  TEST_ASSERT(memcmp(&test_model.cgram[3 * 8], bitmap, 8) == 0);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 1, 4), 3);
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+// Non-blocking marquee, LCD_MARQUEE_LOOP: static view, scrolling, static view of the end, beginning again
+void test_marquee(void)
+{
+  static lcd_marquee_t marquee;
+  uint8_t i;
+
+  test_lcd_setup();
+
+  TEST_ASSERT(lcd_marquee_start(&test_lcd, &marquee, 1, 2, 5, 100, "Hello marquee world ", LCD_MARQUEE_LOOP));
+  test_lcd_sync(&test_lcd);
+  TEST_LCD_ASSERT_ROW(&test_model, 1, "  Hello             ");
+
+  host_advance_us(LCD_WINDOW_PRINT_DELAY_MS / 2 * 1000);
+  hd44780_op_start(&test_model);
+  lcd_marquee_handle();
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(test_model.op_data, 0);
+
+  host_advance_us(LCD_WINDOW_PRINT_DELAY_MS / 2 * 1000);
+  lcd_marquee_handle();
+  test_lcd_sync(&test_lcd);
+  TEST_LCD_ASSERT_ROW(&test_model, 1, "  ello              ");
+
+  host_advance_us(100 * 1000);
+  lcd_marquee_handle();
+  test_lcd_sync(&test_lcd);
+  TEST_LCD_ASSERT_ROW(&test_model, 1, "  llo m             ");
+
+  for (i = 2; i < 15; i++)
+  {
+    host_advance_us(100 * 1000);
+    lcd_marquee_handle();
+  }
+  test_lcd_sync(&test_lcd);
+  TEST_LCD_ASSERT_ROW(&test_model, 1, "  orld              ");
+
+  host_advance_us(LCD_WINDOW_PRINT_DELAY_MS * 1000);
+  lcd_marquee_handle();
+  test_lcd_sync(&test_lcd);
+  TEST_LCD_ASSERT_ROW(&test_model, 1, "  Hello             ");
+
+  lcd_marquee_stop(&marquee);
+  hd44780_op_start(&test_model);
+  host_advance_us(LCD_WINDOW_PRINT_DELAY_MS * 1000);
+  lcd_marquee_handle();
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(test_model.op_data, 0);
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+// Display shift: the whole DDRAM line moves (row 2 is continuation of row 0 on 4 row LCD)
+void test_scroll(void)
+{
+  test_lcd_setup();
+
+  lcd_print_str(&test_lcd, 0, 0, "ABCDEFGHIJKLMNOPQRST");
+  lcd_print_str(&test_lcd, 2, 0, "abc");
+  test_lcd_sync(&test_lcd);
+  lcd_scroll_left(&test_lcd);
+  test_lcd_sync(&test_lcd);
+  TEST_LCD_ASSERT_ROW(&test_model, 0, "BCDEFGHIJKLMNOPQRSTa");
+  TEST_LCD_ASSERT_ROW(&test_model, 2, "bc                 A");
+
+  lcd_scroll_right(&test_lcd);
+  test_lcd_sync(&test_lcd);
+  TEST_LCD_ASSERT_ROW(&test_model, 0, "ABCDEFGHIJKLMNOPQRST");
+  TEST_ASSERT_EQ(test_model.shift, 0);
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+void test_display_control(void)
+{
+  test_lcd_setup();
+
+  lcd_cursor_on(&test_lcd);
+  lcd_blink_on(&test_lcd);
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(test_model.display_ctrl, 0x07);
+
+  lcd_display_off(&test_lcd);
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(test_model.display_ctrl, 0x03);
+
+  lcd_display_on(&test_lcd);
+  lcd_cursor_off(&test_lcd);
+  lcd_blink_off(&test_lcd);
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(test_model.display_ctrl, 0x04);
+
+#ifdef LCD_USE_PCF8574
+  lcd_backlight_off(&test_lcd);
+  TEST_ASSERT(!test_model.backlight);
+  lcd_backlight_on(&test_lcd);
+  TEST_ASSERT(test_model.backlight);
+#endif
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+// Two LCDs on the same bus, each with its own E pin
+void test_two_lcds(void)
+{
+#ifndef LCD_USE_PCF8574
+  static hd44780_t model2;
+  static lcd_t lcd2;
+
+  test_lcd_setup();
+  memset(&lcd2, 0, sizeof(lcd2));
+  lcd2.bus = &test_lcd_bus;
+  lcd2.e.port = &host_gpio_a;
+  lcd2.e.pin = HOST_LCD_E2_PIN;
+  hd44780_attach(&model2, HOST_LCD_E2_PIN);
+  lcd_init(&lcd2, 2, 16);
+  test_lcd_sync(&lcd2);
+
+  lcd_print_str(&test_lcd, 0, 0, "first");
+  lcd_print_str(&lcd2, 0, 0, "second");
+  lcd_print_str(&test_lcd, 1, 0, "1");
+  lcd_print_str(&lcd2, 1, 0, "2");
+#ifdef LCD_ASYNC
+  while (lcd_is_busy(&test_lcd) || lcd_is_busy(&lcd2))
+  { // main loop
+    host_advance_us(1);
+    lcd_task(&test_lcd);
+    lcd_task(&lcd2);
+  }
+#endif
+  test_lcd_sync(&test_lcd);
+  test_lcd_sync(&lcd2);
+
+  TEST_LCD_ASSERT_ROW(&test_model, 0, "first               ");
+  TEST_LCD_ASSERT_ROW(&test_model, 1, "1                   ");
+  TEST_LCD_ASSERT_ROW(&model2, 0, "second              ");
+  TEST_LCD_ASSERT_ROW(&model2, 1, "2                   ");
+  TEST_ASSERT_EQ(test_model.errors, 0);
+  TEST_ASSERT_EQ(model2.errors, 0);
+#endif
+}
+
+// Bus time per operation (until LCD has executed the last transfer)
+void test_bus_time(void)
+{
+  uint32_t bus_time_us;
+
+  test_lcd_setup();
+
+  lcd_print_str(&test_lcd, 0, 0, "01234567890123456789");
+  test_lcd_sync(&test_lcd);
+  bus_time_us = hd44780_op_bus_time_us(&test_model);
+  printf("%-48s %8u us bus time\n", "lcd_print_str 20 characters", (unsigned)bus_time_us);
+  TEST_ASSERT(bus_time_us >= 20 * HD44780_EXEC_US);
+  TEST_ASSERT_EQ(test_model.op_data, 20);
+
+  hd44780_op_start(&test_model);
+  lcd_print_str(&test_lcd, 1, 0, "x");
+  test_lcd_sync(&test_lcd);
+  printf("%-48s %8u us bus time\n", "lcd_print_str 1 character", (unsigned)hd44780_op_bus_time_us(&test_model));
+
+  hd44780_op_start(&test_model);
+  lcd_clear(&test_lcd);
+  test_lcd_sync(&test_lcd);
+  bus_time_us = hd44780_op_bus_time_us(&test_model);
+  printf("%-48s %8u us bus time\n", "lcd_clear", (unsigned)bus_time_us);
+#ifndef LCD_USE_FRAMEBUFFER
+  TEST_ASSERT(bus_time_us >= HD44780_CLEAR_US);
+#endif
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+// PCF8574: string of a whole row is sent with cursor command in a single I2C transaction (4 bytes per transfer)
+void test_i2c_transactions(void)
+{
+#ifdef LCD_USE_PCF8574
+  test_lcd_setup();
+
+  host_i2c.transactions = 0;
+  lcd_print_str(&test_lcd, 0, 0, "0123456789ABCDEF");
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(host_i2c.transactions, 1);
+  TEST_ASSERT_EQ(host_i2c.log[0].address, LCD_PCF8574_ADDRESS);
+  TEST_ASSERT_EQ(host_i2c.log[0].len, 4 * (1 + 16));
+
+  host_i2c.transactions = 0;
+  lcd_print_str(&test_lcd, 1, 0, "0123456789ABCDEFGHIJ");
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(host_i2c.transactions, 1);
+  TEST_ASSERT_EQ(host_i2c.log[0].len, 4 * (1 + TEST_LCD_COLS));
+
+  TEST_LCD_ASSERT_ROW(&test_model, 0, "0123456789ABCDEF    ");
+  TEST_LCD_ASSERT_ROW(&test_model, 1, "0123456789ABCDEFGHIJ");
+  TEST_ASSERT_EQ(test_model.errors, 0);
+#endif
+}
+
+// Main loop (LCD_ASYNC): lcd_task() never waits and does a bounded amount of work per call - one transfer step
+// (E edge, with RS and data pins) and at most one completed transfer. LCD is busy until pending delay (after clear)
+// has passed. Time of lcd_task() calls is measured in bench_lcd.
+void test_main_loop(void)
+{
+#ifdef LCD_ASYNC
+#if defined(LCD_USE_PORT_WRITE)
+  const uint32_t max_pin_writes = 1 + 1 + 1; // RS, data port, E
+#elif defined(LCD_8BIT_MODE)
+  const uint32_t max_pin_writes = 1 + 8 + 1; // RS, D0-D7, E
+#else
+  const uint32_t max_pin_writes = 1 + 4 + 1; // RS, D4-D7, E
+#endif
+  uint32_t delays, pin_writes, transfers;
+  uint32_t max_call_pin_writes = 0;
+  uint32_t max_call_transfers = 0;
+  uint32_t calls = 0;
+
+  test_lcd_setup();
+  lcd_print_str(&test_lcd, 0, 0, "Main loop");
+  test_lcd_sync(&test_lcd);
+  lcd_clear(&test_lcd);
+  lcd_print_str(&test_lcd, 1, 0, "after clear");
+  lcd_refresh(&test_lcd);
+
+  delays = host_lcd_stats.delays;
+  while (lcd_is_busy(&test_lcd))
+  {
+    host_advance_us(1); // other main loop work
+    pin_writes = host_lcd_stats.pin_writes;
+    transfers = test_model.commands + test_model.data;
+    lcd_task(&test_lcd);
+    pin_writes = host_lcd_stats.pin_writes - pin_writes;
+    transfers = test_model.commands + test_model.data - transfers;
+    if (pin_writes > max_call_pin_writes)
+    {
+      max_call_pin_writes = pin_writes;
+    }
+    if (transfers > max_call_transfers)
+    {
+      max_call_transfers = transfers;
+    }
+    calls++;
+  }
+  TEST_ASSERT_EQ(host_lcd_stats.delays, delays); // no blocking delays
+  TEST_ASSERT(max_call_pin_writes <= max_pin_writes);
+  TEST_ASSERT_EQ(max_call_transfers, 1);
+  TEST_ASSERT(calls > HD44780_CLEAR_US); // clear delay is passed in many short calls
+
+  // not busy: LCD accepts next command right away
+  TEST_ASSERT(host_time_us() >= test_model.busy_until_us);
+  TEST_LCD_ASSERT_ROW(&test_model, 1, "after clear         ");
+  lcd_print_str(&test_lcd, 0, 0, "X");
+  test_lcd_sync(&test_lcd);
+  TEST_LCD_ASSERT_ROW(&test_model, 0, "X                   ");
+  TEST_ASSERT_EQ(test_model.errors, 0);
+#endif
+}
+
+// Marquee of string longer than 255 characters, LCD_MARQUEE_PING_PONG: scrolls to the end and back
+void test_marquee_long(void)
+{
+  static lcd_marquee_t marquee;
+  static char text[301];
+  uint16_t i;
+
+  for (i = 0; i < 300; i++)
+  {
+    text[i] = 'a' + (i % 26);
+  }
+  memcpy(&text[290], "0123456789", 10); // end of string
+  text[300] = '\0';
+
+  test_lcd_setup();
+  TEST_ASSERT(lcd_marquee_start(&test_lcd, &marquee, 0, 0, 10, 10, text, LCD_MARQUEE_PING_PONG));
+  TEST_ASSERT_EQ(marquee.length, 300);
+  test_lcd_sync(&test_lcd);
+  TEST_LCD_ASSERT_ROW(&test_model, 0, "abcdefghij          ");
+
+  // static view, then 290 scroll steps (main loop sends each step, async queue is smaller than all steps)
+  host_advance_us(LCD_WINDOW_PRINT_DELAY_MS * 1000);
+  lcd_marquee_handle();
+  test_lcd_sync(&test_lcd);
+  for (i = 1; i < 290; i++)
+  {
+    host_advance_us(10 * 1000);
+    lcd_marquee_handle();
+    test_lcd_sync(&test_lcd);
+  }
+  TEST_ASSERT_EQ(marquee.offset, 290);
+  TEST_LCD_ASSERT_ROW(&test_model, 0, "0123456789          ");
+
+  // end of string stays still, then scrolls back
+  host_advance_us(10 * 1000);
+  lcd_marquee_handle();
+  TEST_ASSERT_EQ(marquee.offset, 290);
+  host_advance_us(LCD_WINDOW_PRINT_DELAY_MS * 1000);
+  lcd_marquee_handle();
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(marquee.offset, 289);
+  TEST_LCD_ASSERT_ROW(&test_model, 0, "d012345678          ");
+
+  lcd_marquee_stop(&marquee);
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+int main(void)
+{
+  TEST_RUN(test_init);
+  TEST_RUN(test_print_str);
+  TEST_RUN(test_print_numbers);
+#ifdef LCD_GO_TO_NEW_LINE_IF_STRING_TOO_LONG
+  TEST_RUN(test_print_str_new_line);
+#endif
+  TEST_RUN(test_clear);
+  TEST_RUN(test_refresh_changed_only);
+  TEST_RUN(test_async);
+  TEST_RUN(test_busy_flag);
+  TEST_RUN(test_glyph_cache);
+  TEST_RUN(test_create_char);
+  TEST_RUN(test_marquee);
+  TEST_RUN(test_marquee_long);
+  TEST_RUN(test_scroll);
+  TEST_RUN(test_display_control);
+  TEST_RUN(test_two_lcds);
+  TEST_RUN(test_bus_time);
+  TEST_RUN(test_i2c_transactions);
+  TEST_RUN(test_main_loop);
+
+  return TEST_RESULT();
+}
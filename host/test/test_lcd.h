@@ -0,0 +1,98 @@
+/**
+ ******************************************************************************
+ * File Name          : test_lcd.h
+ * Description        : This file provides LCD test fixture: 4x20 LCD on host bus,
+ *                      connected to HD44780 model (host build)
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+ *
+ * LCD options are set by build (each test is built for all valid option combinations, see host/CMakeLists.txt).
+ * Test calls test_lcd_setup(), LCD functions and test_lcd_sync() (framebuffer refresh, async queue is sent),
+ * then checks what model displays.
+ */
+
+#ifndef __TEST_LCD_H
+#define __TEST_LCD_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "hd44780.h"
+#include "host.h"
+#include "lcd.h"
+#include "test.h"
+
+#define TEST_LCD_ROWS 4
+#define TEST_LCD_COLS 20
+
+static lcd_bus_t test_lcd_bus = {
+    .d = {{&host_gpio_b, HOST_PIN(0)}, {&host_gpio_b, HOST_PIN(1)}, {&host_gpio_b, HOST_PIN(2)},
+          {&host_gpio_b, HOST_PIN(3)}, {&host_gpio_b, HOST_PIN(4)}, {&host_gpio_b, HOST_PIN(5)},
+          {&host_gpio_b, HOST_PIN(6)}, {&host_gpio_b, HOST_PIN(7)}},
+    .rs = {&host_gpio_a, HOST_LCD_RS_PIN},
+    .rw = {&host_gpio_a, HOST_LCD_RW_PIN}};
+static lcd_t test_lcd;
+static hd44780_t test_model;
+
+// Displayed row of model must match expected string
+#define TEST_LCD_ASSERT_ROW(model, row, expected)                                                               \
+  do                                                                                                            \
+  {                                                                                                             \
+    char _row[TEST_LCD_COLS + 1];                                                                               \
+    hd44780_row((model), (row), TEST_LCD_COLS, _row);                                                           \
+    TEST_ASSERT_STR(_row, (expected));                                                                          \
+  } while (0)
+
+// Send everything to LCD: framebuffer refresh, queued transfers (LCD_ASYNC) are sent by lcd_task() calls,
+// simulated time jumps to each step deadline. Returns when LCD has executed the last transfer.
+static inline void test_lcd_sync(lcd_t *lcd)
+{
+#ifdef LCD_ASYNC
+  uint32_t elapsed_us;
+#endif
+
+  lcd_refresh(lcd);
+#ifdef LCD_ASYNC
+  do
+  {
+    elapsed_us = lcd_get_us() - lcd->async.timestamp;
+    if (elapsed_us < lcd->async.wait_us)
+    {
+      host_advance_us(lcd->async.wait_us - elapsed_us);
+    }
+    lcd_task(lcd);
+  } while (lcd_is_busy(lcd));
+  elapsed_us = lcd_get_us() - lcd->async.timestamp;
+  if (elapsed_us < lcd->async.wait_us)
+  {
+    host_advance_us(lcd->async.wait_us - elapsed_us);
+  }
+#endif
+}
+
+// Reset fake hardware, connect model and init 4x20 LCD
+static inline void test_lcd_setup(void)
+{
+  host_reset();
+  hd44780_detach_all();
+
+  memset(&test_lcd, 0, sizeof(test_lcd));
+  test_lcd.bus = &test_lcd_bus;
+  test_lcd.e.port = &host_gpio_a;
+  test_lcd.e.pin = HOST_LCD_E_PIN;
+#ifdef LCD_USE_PCF8574
+  hd44780_attach_i2c(&test_model, LCD_PCF8574_ADDRESS);
+#else
+  hd44780_attach(&test_model, HOST_LCD_E_PIN);
+#endif
+
+  lcd_init(&test_lcd, TEST_LCD_ROWS, TEST_LCD_COLS);
+  test_lcd_sync(&test_lcd);
+  hd44780_op_start(&test_model);
+}
+
+#endif /* __TEST_LCD_H */
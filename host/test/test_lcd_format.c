@@ -0,0 +1,189 @@
+/**
+ ******************************************************************************
+ * File Name          : test_lcd_format.c
+ * Description        : This file provides LCD number formatting tests against snprintf() (host build)
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+ *
+ * Private number formatter of lcd.c is compared byte for byte with snprintf() for boundary and random
+ * integer parts, all decimals, widths and padding. lcd_print_int_width() and lcd_print_fixed() are compared on
+ * LCD model.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "test_lcd.h"
+
+#define TEST_NUM_BUFF_SIZE 24 // LCD_NUM_BUFF_SIZE of lcd.c
+#define TEST_MAX_DECIMALS 9   // LCD_NUM_MAX_DECIMALS of lcd.c
+#define TEST_RANDOM_NUMBERS 2000
+
+// private function of lcd.c
+void _lcd_format_number(char *buf, bool negative, uint32_t int_part, uint32_t frac_part, uint8_t decimals,
+                        uint8_t width, bool zero_pad);
+
+static const uint32_t test_pow10[TEST_MAX_DECIMALS + 1] = {1,      10,      100,      1000,      10000,
+                                                           100000, 1000000, 10000000, 100000000, 1000000000};
+
+uint32_t test_random(uint32_t *state)
+{
+  *state = *state * 1103515245u + 12345u;
+  return (*state >> 16) | ((*state << 16) & 0xFFFF0000u);
+}
+
+// snprintf() formats "[-]int_part[.frac_part]", padded to width with spaces or zeros after sign
+void test_snprintf_number(char *buf, size_t size, bool negative, uint32_t int_part, uint32_t frac_part,
+                          uint8_t decimals, uint8_t width, bool zero_pad)
+{
+  char number[2 * TEST_NUM_BUFF_SIZE];
+  int int_width = width - (negative ? 1 : 0) - (decimals ? (decimals + 1) : 0);
+
+  if (int_width > TEST_NUM_BUFF_SIZE)
+  {
+    int_width = TEST_NUM_BUFF_SIZE;
+  }
+  else if (int_width < 0)
+  {
+    int_width = 0;
+  }
+
+  if (zero_pad)
+  {
+    snprintf(number, sizeof(number), "%s%0*lu", negative ? "-" : "", int_width, (unsigned long)int_part);
+  }
+  else
+  {
+    snprintf(number, sizeof(number), "%s%lu", negative ? "-" : "", (unsigned long)int_part);
+  }
+  if (decimals)
+  {
+    snprintf(&number[strlen(number)], sizeof(number) - strlen(number), ".%.*lu", decimals, (unsigned long)frac_part);
+  }
+  snprintf(buf, size, "%*s", width, number);
+}
+
+// Compare formatter with snprintf() for all decimals, widths and padding, returns number of mismatches
+uint32_t test_format_all(bool negative, uint32_t int_part, uint32_t frac_seed)
+{
+  char actual[TEST_NUM_BUFF_SIZE];
+  char expected[2 * TEST_NUM_BUFF_SIZE];
+  uint32_t frac_part;
+  uint32_t mismatches = 0;
+  uint8_t decimals, width, zero_pad;
+
+  for (decimals = 0; decimals <= TEST_MAX_DECIMALS; decimals++)
+  {
+    frac_part = frac_seed % test_pow10[decimals];
+    // integer part, '.' and all decimals must fit, formatter limits width to buffer size
+    for (width = 0; width < TEST_NUM_BUFF_SIZE; width++)
+    {
+      for (zero_pad = 0; zero_pad < 2; zero_pad++)
+      {
+        _lcd_format_number(actual, negative, int_part, frac_part, decimals, width, zero_pad);
+        test_snprintf_number(expected, sizeof(expected), negative, int_part, frac_part, decimals, width, zero_pad);
+        if (strcmp(actual, expected) != 0)
+        {
+          if (mismatches == 0)
+          {
+            printf("  int %lu frac %lu decimals %u width %u%s%s: \"%s\", expected \"%s\"\n", (unsigned long)int_part,
+                   (unsigned long)frac_part, decimals, width, negative ? " negative" : "", zero_pad ? " zero_pad" : "",
+                   actual, expected);
+          }
+          mismatches++;
+        }
+      }
+    }
+  }
+  return mismatches;
+}
+
+void test_format_boundaries(void)
+{
+  const uint32_t values[] = {0,          1,          9,          10,         99,         100,        999,
+                             1000,       9999,       10000,      65535,      65536,      99999,      100000,
+                             999999,     1000000,    9999999,    10000000,   99999999,   100000000,  999999999,
+                             1000000000, 2147483647, 2147483648, 4000000000, 4294967294, 4294967295};
+  const uint32_t fracs[] = {0, 1, 5, 999999999, 123456789, 100000000};
+  uint32_t mismatches = 0;
+  uint32_t v, f;
+
+  for (v = 0; v < (sizeof(values) / sizeof(values[0])); v++)
+  {
+    for (f = 0; f < (sizeof(fracs) / sizeof(fracs[0])); f++)
+    {
+      mismatches += test_format_all(false, values[v], fracs[f]);
+      mismatches += test_format_all(true, values[v], fracs[f]);
+    }
+  }
+  TEST_ASSERT_EQ(mismatches, 0);
+}
+
+void test_format_random(void)
+{
+  uint32_t rnd = 1;
+  uint32_t mismatches = 0;
+  uint32_t i, int_part;
+
+  for (i = 0; i < TEST_RANDOM_NUMBERS; i++)
+  {
+    int_part = test_random(&rnd) >> (test_random(&rnd) % 32); // all magnitudes
+    mismatches += test_format_all((i & 0x01), int_part, test_random(&rnd));
+  }
+  TEST_ASSERT_EQ(mismatches, 0);
+}
+
+// Public print functions on LCD model: lcd_print_int_width() is "%*ld"/"%0*ld", lcd_print_fixed() is num / 10^decimals
+void test_print_int_fixed(void)
+{
+  const int32_t values[] = {0, 7, -7, 42, -1234, 99999, -100000, 2147483647, -2147483647 - 1};
+  char expected[TEST_LCD_COLS + 1];
+  char row[TEST_LCD_COLS + 1];
+  uint32_t abs_value;
+  uint8_t v, width, decimals;
+
+  test_lcd_setup();
+  for (v = 0; v < (sizeof(values) / sizeof(values[0])); v++)
+  {
+    abs_value = (values[v] < 0) ? (0 - (uint32_t)values[v]) : (uint32_t)values[v];
+    for (width = 0; width <= 14; width += 7)
+    {
+      lcd_clear(&test_lcd);
+      lcd_print_int_width(&test_lcd, 0, 0, values[v], width, false);
+      lcd_print_int_width(&test_lcd, 1, 0, values[v], width, true);
+      for (decimals = 0; decimals < 2; decimals++)
+      {
+        lcd_print_fixed(&test_lcd, 2 + decimals, 0, values[v], 3 + 3 * decimals, width, true);
+      }
+      test_lcd_sync(&test_lcd);
+
+      snprintf(expected, sizeof(expected), "%*ld", width, (long)values[v]);
+      snprintf(row, sizeof(row), "%-*s", TEST_LCD_COLS, expected);
+      TEST_LCD_ASSERT_ROW(&test_model, 0, row);
+      snprintf(expected, sizeof(expected), "%0*ld", width, (long)values[v]);
+      snprintf(row, sizeof(row), "%-*s", TEST_LCD_COLS, expected);
+      TEST_LCD_ASSERT_ROW(&test_model, 1, row);
+      for (decimals = 0; decimals < 2; decimals++)
+      {
+        test_snprintf_number(expected, sizeof(expected), (values[v] < 0), abs_value / test_pow10[3 + 3 * decimals],
+                             abs_value % test_pow10[3 + 3 * decimals], 3 + 3 * decimals, width, true);
+        snprintf(row, sizeof(row), "%-*s", TEST_LCD_COLS, expected);
+        TEST_LCD_ASSERT_ROW(&test_model, 2 + decimals, row);
+      }
+    }
+  }
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+int main(void)
+{
+  TEST_RUN(test_format_boundaries);
+  TEST_RUN(test_format_random);
+  TEST_RUN(test_print_int_fixed);
+
+  return TEST_RESULT();
+}
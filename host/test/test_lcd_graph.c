@@ -0,0 +1,193 @@
+/**
+ ******************************************************************************
+ * File Name          : test_lcd_graph.c
+ * Description        : This file provides LCD bar graphs and big digits tests (host build)
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "lcd_graph.h"
+#include "test_lcd.h"
+
+void test_hbar(void)
+{
+  lcd_bar_t bar;
+  uint8_t i;
+
+  test_lcd_setup();
+  lcd_graph_load_glyphs(&test_lcd, LCD_GRAPH_GLYPHS_HBAR_DIGITS);
+  lcd_bar_init(&test_lcd, &bar, 1, 2, 10, LCD_BAR_HORIZONTAL);
+
+  test_lcd_sync(&test_lcd); // glyphs are uploaded
+  hd44780_op_start(&test_model);
+  lcd_bar_draw(&bar, 25, 50); // 25 of 50 pixels
+  test_lcd_sync(&test_lcd);
+  for (i = 0; i < 10; i++)
+  {
+    TEST_ASSERT_EQ(hd44780_char_at(&test_model, 1, 2 + i), (i < 5) ? 0xFF : ' ');
+  }
+#ifndef LCD_USE_FRAMEBUFFER // with framebuffer, blank cells are not sent
+  TEST_ASSERT_EQ(test_model.op_commands, 1); // whole bar after single cursor set
+  TEST_ASSERT_EQ(test_model.op_data, 10);
+#endif
+
+  hd44780_op_start(&test_model);
+  lcd_bar_draw(&bar, 27, 50); // 2 pixel columns in the 6th character
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(test_model.op_commands, 1); // only changed character
+  TEST_ASSERT_EQ(test_model.op_data, 1);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 1, 7), 1);
+  TEST_ASSERT_EQ(test_model.cgram[1 * 8], 0x18);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 1, 8), ' ');
+
+  // unchanged bar is not sent again
+  hd44780_op_start(&test_model);
+  lcd_bar_draw(&bar, 27, 50);
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(test_model.op_data, 0);
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+void test_vbar(void)
+{
+  lcd_bar_t bar;
+
+  test_lcd_setup();
+  lcd_graph_load_glyphs(&test_lcd, LCD_GRAPH_GLYPHS_VBAR);
+  lcd_bar_init(&test_lcd, &bar, 3, 19, 4, LCD_BAR_VERTICAL);
+
+  lcd_bar_draw(&bar, 12, 32); // 12 of 32 pixel rows
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 3, 19), 0xFF);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 2, 19), 3);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 1, 19), ' ');
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 0, 19), ' ');
+  TEST_ASSERT_EQ(test_model.cgram[3 * 8 + 3], 0x00);
+  TEST_ASSERT_EQ(test_model.cgram[3 * 8 + 4], 0x1F);
+
+  lcd_bar_draw(&bar, 32, 32);
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 0, 19), 0xFF);
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+// Bars longer than space from (y, x) to LCD edge are shortened instead of wrapping to other rows
+void test_bar_clamp(void)
+{
+  lcd_bar_t bar;
+
+  test_lcd_setup();
+  lcd_graph_load_glyphs(&test_lcd, LCD_GRAPH_GLYPHS_VBAR);
+  lcd_bar_init(&test_lcd, &bar, 1, 0, 4, LCD_BAR_VERTICAL);
+  TEST_ASSERT_EQ(bar.length, 2);
+  lcd_bar_draw(&bar, 100, 100);
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 1, 0), 0xFF);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 0, 0), 0xFF);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 3, 0), ' ');
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 2, 0), ' ');
+
+  lcd_graph_load_glyphs(&test_lcd, LCD_GRAPH_GLYPHS_HBAR_DIGITS);
+  lcd_bar_init(&test_lcd, &bar, 2, 15, 10, LCD_BAR_HORIZONTAL);
+  TEST_ASSERT_EQ(bar.length, 5);
+  lcd_bar_draw(&bar, 100, 100);
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 2, 14), ' ');
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 2, 15), 0xFF);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 2, 19), 0xFF);
+  TEST_LCD_ASSERT_ROW(&test_model, 3, "                    ");
+
+  // outside of LCD: nothing is drawn (LCD would show it in row 0)
+  lcd_bar_init(&test_lcd, &bar, 2, 25, 10, LCD_BAR_HORIZONTAL);
+  TEST_ASSERT_EQ(bar.length, 0);
+  lcd_bar_init(&test_lcd, &bar, 4, 3, 10, LCD_BAR_HORIZONTAL);
+  TEST_ASSERT_EQ(bar.length, 0);
+  lcd_graph_load_glyphs(&test_lcd, LCD_GRAPH_GLYPHS_VBAR);
+  lcd_bar_init(&test_lcd, &bar, 4, 3, 2, LCD_BAR_VERTICAL);
+  TEST_ASSERT_EQ(bar.length, 0);
+  test_lcd_sync(&test_lcd); // glyphs are uploaded
+  hd44780_op_start(&test_model);
+  lcd_bar_draw(&bar, 100, 100);
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(test_model.op_data, 0);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 0, 3), ' ');
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+void test_big_num(void)
+{
+  lcd_big_num_t num;
+
+  test_lcd_setup();
+  lcd_graph_load_glyphs(&test_lcd, LCD_GRAPH_GLYPHS_HBAR_DIGITS);
+  lcd_big_num_init(&test_lcd, &num, 0, 0, 3);
+
+  test_lcd_sync(&test_lcd); // glyphs are uploaded
+  hd44780_op_start(&test_model);
+  lcd_big_num_draw(&num, 42);
+  test_lcd_sync(&test_lcd);
+#ifndef LCD_USE_FRAMEBUFFER
+  TEST_ASSERT_EQ(test_model.op_commands, 2); // one cursor set per row
+  TEST_ASSERT_EQ(test_model.op_data, 2 * 11);
+#endif
+  // leading zero is blank, "4" = {"FBF", "  F"}, "2" = {"XXF", "FBB"}
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 0, 0), ' ');
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 0, 4), 0xFF);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 0, 5), 5);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 1, 5), ' ');
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 1, 6), 0xFF);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 0, 8), 6);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 1, 9), 5);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 1, 10), 5);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 0, 11), ' ');
+
+  hd44780_op_start(&test_model);
+  lcd_big_num_draw(&num, 42);
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(test_model.op_data, 0);
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+// Big numbers are limited to LCD width, numbers that don't fit in two rows are not drawn
+void test_big_num_clamp(void)
+{
+  lcd_big_num_t num;
+
+  test_lcd_setup();
+  lcd_graph_load_glyphs(&test_lcd, LCD_GRAPH_GLYPHS_HBAR_DIGITS);
+  lcd_big_num_init(&test_lcd, &num, 0, 0, 5); // 19 characters
+  TEST_ASSERT_EQ(num.digits, 5);
+  lcd_big_num_init(&test_lcd, &num, 2, 10, 5); // 7 characters: columns 10 - 16
+  TEST_ASSERT_EQ(num.digits, 2);
+  lcd_big_num_draw(&num, 88);
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 2, 10), 0xFF);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 3, 16), 0xFF);
+  TEST_LCD_ASSERT_ROW(&test_model, 0, "                    ");
+
+  lcd_big_num_init(&test_lcd, &num, 3, 0, 2); // bottom half would be in row 0
+  TEST_ASSERT_EQ(num.digits, 0);
+  hd44780_op_start(&test_model);
+  lcd_big_num_draw(&num, 88);
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(test_model.op_data, 0);
+  TEST_LCD_ASSERT_ROW(&test_model, 0, "                    ");
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+int main(void)
+{
+  TEST_RUN(test_hbar);
+  TEST_RUN(test_vbar);
+  TEST_RUN(test_bar_clamp);
+  TEST_RUN(test_big_num);
+  TEST_RUN(test_big_num_clamp);
+
+  return TEST_RESULT();
+}
@@ -0,0 +1,204 @@
+/**
+ ******************************************************************************
+ * File Name          : test_lcd_term.c
+ * Description        : This file provides LCD text terminal tests (host build)
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "lcd_term.h"
+#include "test_lcd.h"
+
+void test_term_print(void)
+{
+  lcd_term_t term;
+
+  test_lcd_setup();
+  lcd_term_init(&test_lcd, &term, true);
+  test_lcd_sync(&test_lcd);
+
+  lcd_term_print(&term, "Boot OK\nTemp: 21.5 C\n");
+  test_lcd_sync(&test_lcd);
+  TEST_LCD_ASSERT_ROW(&test_model, 0, "Boot OK             ");
+  TEST_LCD_ASSERT_ROW(&test_model, 1, "Temp: 21.5 C        ");
+  TEST_LCD_ASSERT_ROW(&test_model, 2, "                    ");
+
+  lcd_term_print(&term, "Progress 10%\rProgress 20%");
+  test_lcd_sync(&test_lcd);
+  TEST_LCD_ASSERT_ROW(&test_model, 2, "Progress 20%        ");
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+void test_term_scroll(void)
+{
+  lcd_term_t term;
+
+  test_lcd_setup();
+  lcd_term_init(&test_lcd, &term, true);
+  lcd_term_print(&term, "line 1\nline 2\nline 3\nline 4\nline 5");
+  test_lcd_sync(&test_lcd);
+  TEST_LCD_ASSERT_ROW(&test_model, 0, "line 2              ");
+  TEST_LCD_ASSERT_ROW(&test_model, 3, "line 5              ");
+
+  lcd_term_scroll(&term, 1);
+  test_lcd_sync(&test_lcd);
+  TEST_LCD_ASSERT_ROW(&test_model, 0, "line 1              ");
+  TEST_LCD_ASSERT_ROW(&test_model, 3, "line 4              ");
+
+  lcd_term_scroll(&term, -LCD_TERM_HISTORY);
+  test_lcd_sync(&test_lcd);
+  TEST_LCD_ASSERT_ROW(&test_model, 0, "line 2              ");
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+// Whole 4x20 screen must match expected rows
+#define TEST_TERM_ASSERT_SCREEN(row0, row1, row2, row3)                                                         \
+  do                                                                                                            \
+  {                                                                                                             \
+    test_lcd_sync(&test_lcd);                                                                                   \
+    TEST_LCD_ASSERT_ROW(&test_model, 0, (row0));                                                                \
+    TEST_LCD_ASSERT_ROW(&test_model, 1, (row1));                                                                \
+    TEST_LCD_ASSERT_ROW(&test_model, 2, (row2));                                                                \
+    TEST_LCD_ASSERT_ROW(&test_model, 3, (row3));                                                                \
+  } while (0)
+
+// Lines wider than LCD continue in the next row, full screen scrolls up
+void test_term_wrap(void)
+{
+  lcd_term_t term;
+
+  test_lcd_setup();
+  lcd_term_init(&test_lcd, &term, true);
+  lcd_term_print(&term, "0123456789ABCDEFGHIJ0123456789abcdefghijXYZ");
+  TEST_TERM_ASSERT_SCREEN("0123456789ABCDEFGHIJ", "0123456789abcdefghij", "XYZ                 ",
+                          "                    ");
+
+  lcd_term_print(&term, "\nend of line 4 here and wrapped");
+  TEST_TERM_ASSERT_SCREEN("0123456789abcdefghij", "XYZ                 ", "end of line 4 here a",
+                          "nd wrapped          ");
+
+  // '\r' returns to the beginning of wrapped (last) row only
+  lcd_term_print(&term, "\rND");
+  TEST_TERM_ASSERT_SCREEN("0123456789abcdefghij", "XYZ                 ", "end of line 4 here a",
+                          "ND wrapped          ");
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+// Without wrap, lines up to LCD_TERM_LINE_LEN are kept and panned (4 row LCD: visible part is redrawn)
+void test_term_pan(void)
+{
+  lcd_term_t term;
+
+  test_lcd_setup();
+  lcd_term_init(&test_lcd, &term, false);
+  TEST_ASSERT(!term.hw_pan);
+  lcd_term_print(&term, "0123456789ABCDEFGHIJ0123456789abcdefghij-discarded\nshort\n"
+                        "....................right side of line");
+  TEST_TERM_ASSERT_SCREEN("0123456789ABCDEFGHIJ", "short               ", "....................",
+                          "                    ");
+
+  lcd_term_pan(&term, 10);
+  TEST_TERM_ASSERT_SCREEN("ABCDEFGHIJ0123456789", "                    ", "..........right side",
+                          "                    ");
+
+  lcd_term_pan(&term, 30); // limited to LCD_TERM_LINE_LEN - LCD width
+  TEST_ASSERT_EQ(term.pan, LCD_TERM_LINE_LEN - TEST_LCD_COLS);
+  TEST_TERM_ASSERT_SCREEN("0123456789abcdefghij", "                    ", "right side of line  ",
+                          "                    ");
+
+  // unchanged characters are not sent again
+  hd44780_op_start(&test_model);
+  lcd_term_pan(&term, 20);
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(test_model.op_data, 0);
+
+  lcd_term_pan(&term, 0);
+  TEST_TERM_ASSERT_SCREEN("0123456789ABCDEFGHIJ", "short               ", "....................",
+                          "                    ");
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+// Stored characters are redrawn as they are: custom character codes and ESC take exactly one LCD cell
+void test_term_raw_chars(void)
+{
+  lcd_term_t term;
+
+  test_lcd_setup();
+  lcd_term_init(&test_lcd, &term, true);
+  lcd_term_print(&term, "a\x01" "b\x1B" "c\x07" "d");
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 0, 1), 0x01);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 0, 3), 0x1B);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 0, 4), 'c');
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 0, 5), 0x07);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 0, 6), 'd');
+
+  // line is redrawn from history in another row
+  lcd_term_print(&term, "\n1\n2\n3\n4");
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 0, 0), '1');
+  lcd_term_scroll(&term, 1);
+  test_lcd_sync(&test_lcd);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 0, 3), 0x1B);
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 0, 4), 'c');
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 0, 6), 'd');
+  TEST_ASSERT_EQ(hd44780_char_at(&test_model, 0, 7), ' ');
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+// History scrolling: view is limited to kept lines and stays on old lines while new lines are printed
+void test_term_scroll_history(void)
+{
+  lcd_term_t term;
+
+  test_lcd_setup();
+  lcd_term_init(&test_lcd, &term, true);
+  lcd_term_print(&term, "line 1\nline 2\nline 3\nline 4\nline 5\nline 6\nline 7\nline 8\nline 9\nline 10");
+  TEST_TERM_ASSERT_SCREEN("line 7              ", "line 8              ", "line 9              ",
+                          "line 10             ");
+
+  lcd_term_scroll(&term, 2);
+  TEST_TERM_ASSERT_SCREEN("line 5              ", "line 6              ", "line 7              ",
+                          "line 8              ");
+
+  // new line while scrolled back: the same lines stay in view
+  lcd_term_print(&term, "\nline 11");
+  TEST_TERM_ASSERT_SCREEN("line 5              ", "line 6              ", "line 7              ",
+                          "line 8              ");
+
+  // oldest kept line is line 4 (LCD_TERM_HISTORY lines)
+  lcd_term_scroll(&term, LCD_TERM_HISTORY);
+  TEST_TERM_ASSERT_SCREEN("line 4              ", "line 5              ", "line 6              ",
+                          "line 7              ");
+
+  lcd_term_scroll(&term, -1);
+  TEST_TERM_ASSERT_SCREEN("line 5              ", "line 6              ", "line 7              ",
+                          "line 8              ");
+
+  lcd_term_scroll(&term, -LCD_TERM_HISTORY);
+  TEST_TERM_ASSERT_SCREEN("line 8              ", "line 9              ", "line 10             ",
+                          "line 11             ");
+
+  lcd_term_clear(&term);
+  TEST_TERM_ASSERT_SCREEN("                    ", "                    ", "                    ",
+                          "                    ");
+  TEST_ASSERT_EQ(test_model.errors, 0);
+}
+
+int main(void)
+{
+  TEST_RUN(test_term_print);
+  TEST_RUN(test_term_scroll);
+  TEST_RUN(test_term_wrap);
+  TEST_RUN(test_term_pan);
+  TEST_RUN(test_term_scroll_history);
+  TEST_RUN(test_term_raw_chars);
+
+  return TEST_RESULT();
+}
@@ -0,0 +1,215 @@
+/**
+ ******************************************************************************
+ * File Name          : test_ring_buffer.c
+ * Description        : This file provides ring buffer tests (host build)
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+ *
+ * Built with default options, with RB_POWER_OF_TWO_SIZE and with RB_STATISTICS.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ring_buffer.h"
+#include "test.h"
+
+#define TEST_RB_SIZE 8
+
+// Zero-copy API: empty buffer has no data spans, full buffer has no free spans
+void test_span_empty_full(void)
+{
+  uint8_t storage[TEST_RB_SIZE];
+  uint8_t data[TEST_RB_SIZE] = {1, 2, 3, 4, 5, 6, 7, 8};
+  rb_att_t rb;
+  rb_span_t span[2];
+
+  TEST_ASSERT_EQ(ring_buffer_init_static(&rb, storage, sizeof(storage)), RB_OK);
+
+  TEST_ASSERT_EQ(ring_buffer_peek(&rb, span), 0);
+  TEST_ASSERT_EQ(span[0].num, 0);
+  TEST_ASSERT_EQ(span[1].num, 0);
+  TEST_ASSERT_EQ(ring_buffer_reserve(&rb, span), TEST_RB_SIZE);
+  TEST_ASSERT(span[0].data == storage);
+  TEST_ASSERT_EQ(span[0].num, TEST_RB_SIZE);
+  TEST_ASSERT_EQ(span[1].num, 0);
+
+  TEST_ASSERT_EQ(ring_buffer_put(&rb, data, TEST_RB_SIZE), RB_OK);
+  TEST_ASSERT_EQ(ring_buffer_reserve(&rb, span), 0);
+  TEST_ASSERT_EQ(span[0].num, 0);
+  TEST_ASSERT_EQ(span[1].num, 0);
+  TEST_ASSERT_EQ(ring_buffer_peek(&rb, span), TEST_RB_SIZE);
+  TEST_ASSERT(span[0].data == storage);
+  TEST_ASSERT_EQ(span[0].num, TEST_RB_SIZE);
+  TEST_ASSERT_EQ(span[1].num, 0);
+  TEST_ASSERT(memcmp(span[0].data, data, TEST_RB_SIZE) == 0);
+
+  // nothing can be committed to full buffer, nothing can be consumed from empty buffer
+  TEST_ASSERT_EQ(ring_buffer_commit(&rb, 1), RB_NOT_ENOUGH_SPACE);
+  TEST_ASSERT_EQ(ring_buffer_consume(&rb, TEST_RB_SIZE), RB_OK);
+  TEST_ASSERT_EQ(ring_buffer_consume(&rb, 1), RB_NOT_ENOUGH_DATA);
+  TEST_ASSERT_EQ(ring_buffer_size(&rb), 0);
+}
+
+// Free space and data that wrap over buffer last element are returned as two spans
+void test_span_wrapped(void)
+{
+  uint8_t storage[TEST_RB_SIZE];
+  uint8_t data[TEST_RB_SIZE] = {0};
+  const char *text = "ABCDEFGH";
+  rb_att_t rb;
+  rb_span_t span[2];
+
+  TEST_ASSERT_EQ(ring_buffer_init_static(&rb, storage, sizeof(storage)), RB_OK);
+  TEST_ASSERT_EQ(ring_buffer_put(&rb, data, 6), RB_OK);
+  TEST_ASSERT_EQ(ring_buffer_get(&rb, data, 6), RB_OK);
+
+  TEST_ASSERT_EQ(ring_buffer_reserve(&rb, span), TEST_RB_SIZE);
+  TEST_ASSERT(span[0].data == &storage[6]);
+  TEST_ASSERT_EQ(span[0].num, 2);
+  TEST_ASSERT(span[1].data == storage);
+  TEST_ASSERT_EQ(span[1].num, 6);
+  memcpy(span[0].data, text, span[0].num);
+  memcpy(span[1].data, text + span[0].num, span[1].num);
+  TEST_ASSERT_EQ(ring_buffer_commit(&rb, TEST_RB_SIZE), RB_OK);
+  TEST_ASSERT_EQ(ring_buffer_full(&rb), RB_FULL);
+
+  TEST_ASSERT_EQ(ring_buffer_peek(&rb, span), TEST_RB_SIZE);
+  TEST_ASSERT(span[0].data == &storage[6]);
+  TEST_ASSERT_EQ(span[0].num, 2);
+  TEST_ASSERT(span[1].data == storage);
+  TEST_ASSERT_EQ(span[1].num, 6);
+  TEST_ASSERT(memcmp(span[0].data, "AB", 2) == 0);
+  TEST_ASSERT(memcmp(span[1].data, "CDEFGH", 6) == 0);
+
+  // copy API sees the same data
+  TEST_ASSERT_EQ(ring_buffer_get(&rb, data, TEST_RB_SIZE), RB_OK);
+  TEST_ASSERT(memcmp(data, text, TEST_RB_SIZE) == 0);
+}
+
+// Typed buffer: span data pointers and lengths are in elements
+void test_span_wrapped_typed(void)
+{
+  uint32_t storage[4];
+  uint32_t values[5] = {10, 11, 12, 13, 14};
+  rb_att_t rb;
+  rb_span_t span[2];
+
+  TEST_ASSERT_EQ(ring_buffer_init_static_elem(&rb, storage, 4, sizeof(uint32_t)), RB_OK);
+  TEST_ASSERT_EQ(ring_buffer_put(&rb, values, 3), RB_OK);
+  TEST_ASSERT_EQ(ring_buffer_get(&rb, values, 2), RB_OK);
+
+  // 1 stored element at index 2, free: index 3, then 0 - 1
+  TEST_ASSERT_EQ(ring_buffer_reserve(&rb, span), 3);
+  TEST_ASSERT(span[0].data == (uint8_t *)&storage[3]);
+  TEST_ASSERT_EQ(span[0].num, 1);
+  TEST_ASSERT(span[1].data == (uint8_t *)&storage[0]);
+  TEST_ASSERT_EQ(span[1].num, 2);
+  ((uint32_t *)span[0].data)[0] = 20;
+  ((uint32_t *)span[1].data)[0] = 21;
+  TEST_ASSERT_EQ(ring_buffer_commit(&rb, 2), RB_OK);
+
+  TEST_ASSERT_EQ(ring_buffer_peek(&rb, span), 3);
+  TEST_ASSERT_EQ(span[0].num, 2);
+  TEST_ASSERT_EQ(((uint32_t *)span[0].data)[0], 12);
+  TEST_ASSERT_EQ(((uint32_t *)span[0].data)[1], 20);
+  TEST_ASSERT_EQ(span[1].num, 1);
+  TEST_ASSERT_EQ(((uint32_t *)span[1].data)[0], 21);
+}
+
+// Only part of reserved space is committed, only part of peeked data is consumed
+void test_span_partial(void)
+{
+  uint8_t storage[TEST_RB_SIZE];
+  uint8_t data[TEST_RB_SIZE];
+  rb_att_t rb;
+  rb_span_t span[2];
+#ifdef RB_STATISTICS
+  rb_stats_t stats;
+#endif
+
+  TEST_ASSERT_EQ(ring_buffer_init_static(&rb, storage, sizeof(storage)), RB_OK);
+
+  TEST_ASSERT_EQ(ring_buffer_reserve(&rb, span), TEST_RB_SIZE);
+  memcpy(span[0].data, "xyz", 3);
+  TEST_ASSERT_EQ(ring_buffer_commit(&rb, 3), RB_OK);
+  TEST_ASSERT_EQ(ring_buffer_size(&rb), 3);
+  TEST_ASSERT_EQ(ring_buffer_free_elements(&rb), TEST_RB_SIZE - 3);
+  TEST_ASSERT_EQ(ring_buffer_commit(&rb, TEST_RB_SIZE - 2), RB_NOT_ENOUGH_SPACE); // more than free
+  TEST_ASSERT_EQ(ring_buffer_size(&rb), 3);
+
+  // free space starts after committed data
+  TEST_ASSERT_EQ(ring_buffer_reserve(&rb, span), TEST_RB_SIZE - 3);
+  TEST_ASSERT(span[0].data == &storage[3]);
+
+  TEST_ASSERT_EQ(ring_buffer_peek(&rb, span), 3);
+  TEST_ASSERT_EQ(span[0].data[0], 'x');
+  TEST_ASSERT_EQ(ring_buffer_consume(&rb, 1), RB_OK);
+  TEST_ASSERT_EQ(ring_buffer_consume(&rb, 3), RB_NOT_ENOUGH_DATA); // more than stored
+  TEST_ASSERT_EQ(ring_buffer_peek(&rb, span), 2);
+  TEST_ASSERT_EQ(span[0].data[0], 'y');
+  TEST_ASSERT_EQ(ring_buffer_get(&rb, data, 2), RB_OK);
+  TEST_ASSERT(memcmp(data, "yz", 2) == 0);
+  TEST_ASSERT_EQ(ring_buffer_empty(&rb), RB_EMPTY);
+
+#ifdef RB_STATISTICS
+  ring_buffer_get_stats(&rb, &stats);
+  TEST_ASSERT_EQ(stats.total_in, 3);
+  TEST_ASSERT_EQ(stats.total_out, 3);
+  TEST_ASSERT_EQ(stats.high_water, 3);
+  TEST_ASSERT_EQ(stats.rejected, 1);
+  TEST_ASSERT_EQ(stats.underflows, 1);
+#endif
+}
+
+// Delimited frames: nothing is read until delimiter is stored, frames that wrap over buffer end are joined
+void test_get_until(void)
+{
+  uint8_t storage[TEST_RB_SIZE];
+  char data[TEST_RB_SIZE + 1] = {0};
+  rb_att_t rb;
+#ifdef RB_STATISTICS
+  rb_stats_t stats;
+#endif
+
+  TEST_ASSERT_EQ(ring_buffer_init_static(&rb, storage, sizeof(storage)), RB_OK);
+  TEST_ASSERT_EQ(ring_buffer_get_until(&rb, data, sizeof(data), '\n'), 0); // empty
+  TEST_ASSERT_EQ(rb.status, RB_NOT_ENOUGH_DATA);
+
+  TEST_ASSERT_EQ(ring_buffer_put(&rb, "ab\ncd", 5), RB_OK);
+  TEST_ASSERT_EQ(ring_buffer_get_until(&rb, data, sizeof(data), '\n'), 3);
+  TEST_ASSERT_EQ(rb.status, RB_OK);
+  TEST_ASSERT(memcmp(data, "ab\n", 3) == 0);
+  TEST_ASSERT_EQ(ring_buffer_get_until(&rb, data, sizeof(data), '\n'), 0); // incomplete frame
+  TEST_ASSERT_EQ(rb.status, RB_NOT_ENOUGH_DATA);
+  TEST_ASSERT_EQ(ring_buffer_size(&rb), 2);
+
+  // "cdefg\n" is stored at indexes 3 - 7 and 0
+  TEST_ASSERT_EQ(ring_buffer_put(&rb, "efg\n", 4), RB_OK);
+  TEST_ASSERT_EQ(ring_buffer_get_until(&rb, data, 3, '\n'), 0); // delimiter beyond user buffer
+  TEST_ASSERT_EQ(ring_buffer_get_until(&rb, data, sizeof(data), '\n'), 6);
+  TEST_ASSERT(memcmp(data, "cdefg\n", 6) == 0);
+  TEST_ASSERT_EQ(ring_buffer_empty(&rb), RB_EMPTY);
+
+#ifdef RB_STATISTICS
+  ring_buffer_get_stats(&rb, &stats);
+  TEST_ASSERT_EQ(stats.total_in, 9);
+  TEST_ASSERT_EQ(stats.total_out, 9);
+  TEST_ASSERT_EQ(stats.underflows, 3);
+#endif
+}
+
+int main(void)
+{
+  TEST_RUN(test_span_empty_full);
+  TEST_RUN(test_span_wrapped);
+  TEST_RUN(test_span_wrapped_typed);
+  TEST_RUN(test_span_partial);
+  TEST_RUN(test_get_until);
+
+  return TEST_RESULT();
+}
@@ -0,0 +1,287 @@
+/**
+ ******************************************************************************
+ * File Name          : test_ring_buffer_spsc.c
+ * Description        : This file provides ring buffer single producer/single consumer
+ *                      stress test (host build, pthreads)
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+ *
+ * Producer thread puts numbered elements in random chunks, consumer thread gets them and checks that every
+ * element arrives exactly once, in order. Both byte and typed (8 byte elements) buffers are tested with
+ * put/get, put_partial/get_partial and reserve/commit/peek/consume. Head and tail start just before index
+ * wrap-around. Built with default indexes (non power-of-two size) and with RB_POWER_OF_TWO_SIZE.
+ * Each run is timed and throughput (time per element and elements/s, both threads running) is printed.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+#include "ring_buffer.h"
+#include "test.h"
+
+#define SPSC_ELEMENTS 1000000 // elements sent in each test
+#define SPSC_MAX_CHUNK 16     // elements per call, 1 - SPSC_MAX_CHUNK
+#ifdef RB_POWER_OF_TWO_SIZE
+#define SPSC_SIZE 64
+#else
+#define SPSC_SIZE 61
+#endif
+
+typedef struct
+{
+  uint32_t seq;
+  uint32_t check; // ~seq
+} spsc_elem_t;
+
+typedef enum
+{
+  SPSC_COPY,    // ring_buffer_put() / ring_buffer_get()
+  SPSC_PARTIAL, // ring_buffer_put_partial() / ring_buffer_get_partial()
+  SPSC_SPAN     // ring_buffer_reserve() + ring_buffer_commit() / ring_buffer_peek() + ring_buffer_consume()
+} spsc_api_t;
+
+typedef struct
+{
+  rb_att_t *rb;
+  spsc_api_t api;
+  uint32_t received;
+  uint32_t errors;
+} spsc_t;
+
+RING_BUFFER_DEFINE(spsc_bytes, SPSC_SIZE);
+RING_BUFFER_DEFINE_TYPED(spsc_typed, spsc_elem_t, SPSC_SIZE);
+
+// Element number 'seq': byte buffer gets a byte pattern that doesn't repeat every 256 elements
+void spsc_make(uint8_t *elem, uint32_t s_elem, uint32_t seq)
+{
+  spsc_elem_t typed = {.seq = seq, .check = ~seq};
+
+  if (s_elem == 1)
+  {
+    elem[0] = (uint8_t)(seq ^ (seq >> 8) ^ (seq >> 16));
+  }
+  else
+  {
+    memcpy(elem, &typed, sizeof(typed));
+  }
+}
+
+uint32_t spsc_random(uint32_t *state)
+{
+  *state = *state * 1103515245u + 12345u;
+  return *state >> 16;
+}
+
+void *spsc_producer(void *arg)
+{
+  spsc_t *t = arg;
+  uint32_t s_elem = t->rb->s_elem;
+  uint8_t chunk[SPSC_MAX_CHUNK * sizeof(spsc_elem_t)];
+  rb_span_t span[2];
+  uint32_t rnd = 1;
+  uint32_t sent = 0;
+  uint32_t num, done, i;
+
+  while (sent < SPSC_ELEMENTS)
+  {
+    num = 1 + spsc_random(&rnd) % SPSC_MAX_CHUNK;
+    if (num > (SPSC_ELEMENTS - sent))
+    {
+      num = SPSC_ELEMENTS - sent;
+    }
+    for (i = 0; i < num; i++)
+    {
+      spsc_make(&chunk[i * s_elem], s_elem, sent + i);
+    }
+
+    done = 0;
+    switch (t->api)
+    {
+    case SPSC_COPY:
+      if (ring_buffer_put(t->rb, chunk, num) == RB_OK)
+      {
+        done = num;
+      }
+      break;
+    case SPSC_PARTIAL:
+      done = ring_buffer_put_partial(t->rb, chunk, num);
+      break;
+    case SPSC_SPAN:
+      ring_buffer_reserve(t->rb, span);
+      for (i = 0; (i < 2) && (done < num); i++)
+      {
+        uint32_t n = (span[i].num < (num - done)) ? span[i].num : (num - done);
+        memcpy(span[i].data, &chunk[done * s_elem], n * s_elem);
+        done += n;
+      }
+      if (done)
+      {
+        ring_buffer_commit(t->rb, done);
+      }
+      break;
+    }
+    sent += done;
+    if (done == 0)
+    { // buffer is full
+      sched_yield();
+    }
+  }
+  return NULL;
+}
+
+void spsc_check(spsc_t *t, const uint8_t *data, uint32_t num)
+{
+  uint32_t s_elem = t->rb->s_elem;
+  uint8_t expected[sizeof(spsc_elem_t)];
+  uint32_t i;
+
+  for (i = 0; i < num; i++)
+  {
+    spsc_make(expected, s_elem, t->received);
+    if (memcmp(&data[i * s_elem], expected, s_elem) != 0)
+    {
+      if (t->errors == 0)
+      {
+        printf("element %u: unexpected data\n", (unsigned)t->received);
+      }
+      t->errors++;
+    }
+    t->received++;
+  }
+}
+
+void *spsc_consumer(void *arg)
+{
+  spsc_t *t = arg;
+  uint8_t chunk[SPSC_MAX_CHUNK * sizeof(spsc_elem_t)];
+  rb_span_t span[2];
+  uint32_t rnd = 2;
+  uint32_t num, done, i;
+
+  while (t->received < SPSC_ELEMENTS)
+  {
+    num = 1 + spsc_random(&rnd) % SPSC_MAX_CHUNK;
+    if (num > (SPSC_ELEMENTS - t->received))
+    {
+      num = SPSC_ELEMENTS - t->received;
+    }
+
+    done = 0;
+    switch (t->api)
+    {
+    case SPSC_COPY:
+      if (ring_buffer_get(t->rb, chunk, num) == RB_OK)
+      {
+        spsc_check(t, chunk, num);
+        done = num;
+      }
+      break;
+    case SPSC_PARTIAL:
+      done = ring_buffer_get_partial(t->rb, chunk, num);
+      spsc_check(t, chunk, done);
+      break;
+    case SPSC_SPAN:
+      ring_buffer_peek(t->rb, span);
+      for (i = 0; (i < 2) && (done < num); i++)
+      {
+        uint32_t n = (span[i].num < (num - done)) ? span[i].num : (num - done);
+        spsc_check(t, span[i].data, n);
+        done += n;
+      }
+      if (done)
+      {
+        ring_buffer_consume(t->rb, done);
+      }
+      break;
+    }
+    if (done == 0)
+    { // buffer is empty
+      sched_yield();
+    }
+  }
+  return NULL;
+}
+
+void spsc_run(rb_att_t *rb, spsc_api_t api, const char *name)
+{
+  spsc_t t = {.rb = rb, .api = api};
+  pthread_t producer, consumer;
+  uint32_t start;
+  bench_t b;
+  double ns;
+
+  // start just before index wrap-around: free-running indexes wrap at UINT32_MAX, others at 2 * n_elem
+#ifdef RB_POWER_OF_TWO_SIZE
+  start = UINT32_MAX - 3;
+#else
+  start = 2 * rb->n_elem - 3;
+#endif
+  atomic_store(&rb->head, start);
+  atomic_store(&rb->tail, start);
+
+  bench_start(&b);
+  TEST_ASSERT_EQ(pthread_create(&consumer, NULL, spsc_consumer, &t), 0);
+  TEST_ASSERT_EQ(pthread_create(&producer, NULL, spsc_producer, &t), 0);
+  pthread_join(producer, NULL);
+  pthread_join(consumer, NULL);
+  ns = bench_stop(&b, SPSC_ELEMENTS, name);
+  printf("%-48s %10.2f Melem/s\n", "  throughput", 1e3 / ns);
+
+  TEST_ASSERT_EQ(t.received, SPSC_ELEMENTS);
+  TEST_ASSERT_EQ(t.errors, 0);
+  TEST_ASSERT_EQ(ring_buffer_size(rb), 0);
+}
+
+void test_spsc_bytes(void)
+{
+  spsc_run(&spsc_bytes, SPSC_COPY, "bytes put/get");
+}
+
+void test_spsc_bytes_partial(void)
+{
+  spsc_run(&spsc_bytes, SPSC_PARTIAL, "bytes put_partial/get_partial");
+}
+
+void test_spsc_bytes_span(void)
+{
+  spsc_run(&spsc_bytes, SPSC_SPAN, "bytes reserve+commit/peek+consume");
+}
+
+void test_spsc_typed(void)
+{
+  spsc_run(&spsc_typed, SPSC_COPY, "typed put/get");
+}
+
+void test_spsc_typed_partial(void)
+{
+  spsc_run(&spsc_typed, SPSC_PARTIAL, "typed put_partial/get_partial");
+}
+
+void test_spsc_typed_span(void)
+{
+  spsc_run(&spsc_typed, SPSC_SPAN, "typed reserve+commit/peek+consume");
+}
+
+int main(void)
+{
+#ifdef RB_POWER_OF_TWO_SIZE
+  printf("ring buffer size %u, RB_POWER_OF_TWO_SIZE\n", SPSC_SIZE);
+#else
+  printf("ring buffer size %u\n", SPSC_SIZE);
+#endif
+  TEST_RUN(test_spsc_bytes);
+  TEST_RUN(test_spsc_bytes_partial);
+  TEST_RUN(test_spsc_bytes_span);
+  TEST_RUN(test_spsc_typed);
+  TEST_RUN(test_spsc_typed_partial);
+  TEST_RUN(test_spsc_typed_span);
+
+  return TEST_RESULT();
+}
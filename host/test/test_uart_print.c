@@ -0,0 +1,389 @@
+/**
+ ******************************************************************************
+ * File Name          : test_uart_print.c
+ * Description        : This file provides UART print tests (host build)
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+ *
+ * Output captured by fake UART is checked after new line, full buffer and printFlush(). Output of printNumber(),
+ * printNumber64(), printNumberWidth() and printFloatDecimals() is compared byte for byte with snprintf() of the
+ * C library.
+ * Built with default options, with UART_PRINT_BUFFERED and with UART_PRINT_DMA.
+ */
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "host.h"
+#include "test.h"
+#include "uart_print.h"
+
+#define TEST_RANDOM_FLOATS 300000
+#define TEST_RANDOM_NUMBERS 200000
+#define TEST_OUT_SIZE 256
+
+static char test_out[TEST_OUT_SIZE];
+
+uint64_t test_random(uint64_t *state)
+{
+  *state ^= *state << 13;
+  *state ^= *state >> 7;
+  *state ^= *state << 17;
+  return *state;
+}
+
+void test_capture_start(void)
+{
+  printFlush();
+  host_uart.len = 0;
+  host_uart.calls = 0;
+}
+
+// Captured output since test_capture_start(), zero terminated
+const char *test_captured(void)
+{
+  uint32_t len;
+
+  printFlush();
+  len = (host_uart.len < (TEST_OUT_SIZE - 1)) ? host_uart.len : (TEST_OUT_SIZE - 1);
+  memcpy(test_out, host_uart.data, len);
+  test_out[len] = '\0';
+  return test_out;
+}
+
+// Compare printFloatDecimals() with "%.*f", returns 1 on mismatch
+uint32_t test_float(double number, uint8_t decimals)
+{
+  char expected[TEST_OUT_SIZE];
+
+  test_capture_start();
+  printFloatDecimals(number, decimals);
+  snprintf(expected, sizeof(expected), "%.*f", decimals, number);
+  if (strcmp(test_captured(), expected) != 0)
+  {
+    printf("  %a, %u decimals: \"%s\", expected \"%s\"\n", number, decimals, test_out, expected);
+    return 1;
+  }
+  return 0;
+}
+
+// Random doubles of all magnitudes (random bits, scaled integers, values near decimal rounding boundaries)
+void test_float_random(void)
+{
+  uint64_t rnd = 88172645463325252ULL;
+  uint32_t mismatches = 0;
+  uint32_t checked = 0;
+  uint64_t bits;
+  double number;
+  uint32_t i;
+
+  for (i = 0; (i < TEST_RANDOM_FLOATS) && (mismatches < 10); i++)
+  {
+    bits = test_random(&rnd);
+    switch (i % 4)
+    {
+    case 0: // any bit pattern
+      memcpy(&number, &bits, sizeof(number));
+      break;
+    case 1: // binary fractions: ties of decimal rounding
+      number = (double)((int64_t)(test_random(&rnd) % 2000001) - 1000000) / (double)(1u << (test_random(&rnd) % 12));
+      break;
+    case 2: // 53-bit mantissa, exponent -120 ... 19
+      number = ldexp((double)(bits >> 11), (int)(test_random(&rnd) % 140) - 120);
+      break;
+    default: // decimal values with 3 decimals and tiny offset
+      number = (double)(test_random(&rnd) % 100000000) / 1000.0 +
+               (double)(test_random(&rnd) % 10) / (double)(test_random(&rnd) % 7 + 1) * 1e-9;
+      break;
+    }
+    if (bits & 0x02)
+    {
+      number = -number;
+    }
+    if (isnan(number) || isinf(number) || (fabs(number) >= 18446744073709551616.0))
+    { // printed as "nan", "inf" and "ovf", see test_float_special()
+      continue;
+    }
+    mismatches += test_float(number, test_random(&rnd) % (PRINT_FLOAT_MAX_DECIMALS + 1));
+    checked++;
+  }
+  printf("%-48s %8u numbers\n", "printFloatDecimals() vs \"%.*f\"", (unsigned)checked);
+  TEST_ASSERT_EQ(mismatches, 0);
+}
+
+// Ties, zeros, denormals and the largest printed value, with all decimals
+void test_float_boundaries(void)
+{
+  const double numbers[] = {0.0,    -0.0,    0.5,      1.5,          2.5,     0.125,     0.375,    -0.0000001,
+                            1e-300, 4e-324,  0.05,     0.0049999999, 9.5,     0.9999999999, 99.995, 1234567.8905,
+                            4294967295.5,    9007199254740993.0,     18446744073709549568.0};
+  uint32_t mismatches = 0;
+  uint8_t i, decimals;
+
+  for (i = 0; i < (sizeof(numbers) / sizeof(numbers[0])); i++)
+  {
+    for (decimals = 0; decimals <= PRINT_FLOAT_MAX_DECIMALS; decimals++)
+    {
+      mismatches += test_float(numbers[i], decimals);
+      mismatches += test_float(-numbers[i], decimals);
+    }
+  }
+  TEST_ASSERT_EQ(mismatches, 0);
+
+  // printFloat() is "%f"
+  test_capture_start();
+  printFloat(-3.14159265);
+  TEST_ASSERT_STR(test_captured(), "-3.141593");
+}
+
+// Not-a-number and infinity are printed as by printf(), numbers >= 2^64 as "ovf"
+void test_float_special(void)
+{
+  const double numbers[] = {NAN, -NAN, INFINITY, -INFINITY};
+  uint32_t mismatches = 0;
+  uint8_t i;
+
+  for (i = 0; i < (sizeof(numbers) / sizeof(numbers[0])); i++)
+  {
+    mismatches += test_float(numbers[i], 0);
+    mismatches += test_float(numbers[i], PRINT_FLOAT_DECIMALS);
+  }
+  TEST_ASSERT_EQ(mismatches, 0);
+
+  test_capture_start();
+  printFloat(1e30);
+  TEST_ASSERT_STR(test_captured(), "ovf");
+  test_capture_start();
+  printFloatDecimals(-18446744073709551616.0, 2);
+  TEST_ASSERT_STR(test_captured(), "-ovf");
+  test_capture_start();
+  printFloatDecimals(1.0 / 3.0, 20); // limited to PRINT_FLOAT_MAX_DECIMALS
+  TEST_ASSERT_STR(test_captured(), "0.333333333");
+}
+
+// Compare printNumber64() with "%lld", "%llX" and "%llo" (sign and magnitude), returns number of mismatches
+uint32_t test_number64(int64_t number)
+{
+  const uint8_t bases[] = {DEC, HEX, OCT};
+  const char *formats[] = {"%s%" PRIu64, "%s%" PRIX64, "%s%" PRIo64};
+  char expected[TEST_OUT_SIZE];
+  uint64_t abs_number = (number < 0) ? (0ULL - (uint64_t)number) : (uint64_t)number;
+  uint32_t mismatches = 0;
+  uint8_t b;
+
+  for (b = 0; b < sizeof(bases); b++)
+  {
+    test_capture_start();
+    printNumber64(number, bases[b]);
+    snprintf(expected, sizeof(expected), formats[b], (number < 0) ? "-" : "", abs_number);
+    if (strcmp(test_captured(), expected) != 0)
+    {
+      printf("  %" PRId64 ", base %u: \"%s\", expected \"%s\"\n", number, bases[b], test_out, expected);
+      mismatches++;
+    }
+  }
+  return mismatches;
+}
+
+// Compare printNumber() and printNumberWidth() with "%d", "%X", "%o", "%*d" and "%0*d", returns number of mismatches
+uint32_t test_number32(int32_t number, uint8_t width)
+{
+  const uint8_t bases[] = {DEC, HEX, OCT};
+  const char *formats[] = {"%s%" PRIu32, "%s%" PRIX32, "%s%" PRIo32};
+  char expected[TEST_OUT_SIZE];
+  uint32_t abs_number = (number < 0) ? (0U - (uint32_t)number) : (uint32_t)number;
+  uint32_t mismatches = 0;
+  uint8_t b, zero_pad;
+
+  for (b = 0; b < sizeof(bases); b++)
+  {
+    test_capture_start();
+    printNumber(number, bases[b]);
+    snprintf(expected, sizeof(expected), formats[b], (number < 0) ? "-" : "", abs_number);
+    if (strcmp(test_captured(), expected) != 0)
+    {
+      printf("  %" PRId32 ", base %u: \"%s\", expected \"%s\"\n", number, bases[b], test_out, expected);
+      mismatches++;
+    }
+  }
+  for (zero_pad = 0; zero_pad < 2; zero_pad++)
+  {
+    test_capture_start();
+    printNumberWidth(number, DEC, width, zero_pad);
+    snprintf(expected, sizeof(expected), zero_pad ? "%0*" PRId32 : "%*" PRId32, width, number);
+    if (strcmp(test_captured(), expected) != 0)
+    {
+      printf("  %" PRId32 ", width %u%s: \"%s\", expected \"%s\"\n", number, width, zero_pad ? " zero_pad" : "",
+             test_out, expected);
+      mismatches++;
+    }
+  }
+  return mismatches;
+}
+
+// Digit count changes, 8 digit parts of 64-bit numbers, 32/64-bit path switch and minimum values
+void test_number_boundaries(void)
+{
+  uint32_t mismatches = 0;
+  uint64_t pow10 = 1;
+  uint8_t width;
+
+  while (pow10 <= 1000000000000000000ULL)
+  {
+    mismatches += test_number64((int64_t)pow10 - 1);
+    mismatches += test_number64((int64_t)pow10);
+    mismatches += test_number64((int64_t)pow10 + 1);
+    mismatches += test_number64(-(int64_t)pow10);
+    pow10 *= 10;
+  }
+  mismatches += test_number64(UINT32_MAX);
+  mismatches += test_number64((int64_t)UINT32_MAX + 1);
+  mismatches += test_number64(-(int64_t)UINT32_MAX - 1);
+  mismatches += test_number64(INT64_MAX);
+  mismatches += test_number64(INT64_MIN);
+  mismatches += test_number64(INT64_MIN + 1);
+
+  for (width = 0; width <= 24; width++)
+  {
+    mismatches += test_number32(0, width);
+    mismatches += test_number32(INT32_MAX, width);
+    mismatches += test_number32(INT32_MIN, width);
+    mismatches += test_number32(-1, width);
+  }
+  TEST_ASSERT_EQ(mismatches, 0);
+}
+
+// n / 100 is calculated as (n * 0x51EB851F) >> 37: error is largest for the largest 32-bit numbers
+void test_number_reciprocal(void)
+{
+  uint32_t mismatches = 0;
+  uint64_t n;
+
+  for (n = UINT32_MAX - 99999; (n <= UINT32_MAX) && (mismatches < 10); n++)
+  {
+    mismatches += test_number64(n);
+  }
+  for (n = 99; n <= UINT32_MAX; n = n * 3 + (99 - (n * 3) % 100))
+  { // n % 100 == 99, just below next quotient
+    mismatches += test_number64(n);
+    mismatches += test_number64(n + 1);
+  }
+  TEST_ASSERT_EQ(mismatches, 0);
+}
+
+void test_number_random(void)
+{
+  uint64_t rnd = 88172645463325252ULL;
+  uint32_t mismatches = 0;
+  int64_t number;
+  uint32_t i;
+
+  for (i = 0; (i < TEST_RANDOM_NUMBERS) && (mismatches < 10); i++)
+  {
+    number = (int64_t)(test_random(&rnd) >> (test_random(&rnd) % 64)); // all magnitudes
+    if (i & 0x01)
+    {
+      number = -number;
+    }
+    mismatches += test_number64(number);
+    mismatches += test_number32((int32_t)number, test_random(&rnd) % 25);
+  }
+  TEST_ASSERT_EQ(mismatches, 0);
+}
+
+// Without buffer each fragment is sent immediately, with buffer fragments are sent together on new line
+void test_new_line(void)
+{
+  test_capture_start();
+  printString("abc");
+  printNumber(-12, DEC);
+#ifdef UART_PRINT_BUFFERED
+  TEST_ASSERT_EQ(host_uart.len, 0);
+  printLn();
+  TEST_ASSERT_EQ(host_uart.calls, 1);
+#else
+  TEST_ASSERT_EQ(host_uart.len, 6);
+  printLn();
+  TEST_ASSERT_EQ(host_uart.calls, 3); // "abc", "-12", "\n\r"
+#endif
+  TEST_ASSERT_EQ(host_uart.len, 8);
+  TEST_ASSERT_STR(test_captured(), "abc-12\n\r");
+}
+
+// Full buffer is sent, the rest of the string waits for printFlush()
+void test_full_buffer(void)
+{
+  char str[UART_PRINT_BUFFER_SIZE + 21];
+
+  memset(str, 'x', sizeof(str) - 1);
+  str[sizeof(str) - 1] = '\0';
+
+  test_capture_start();
+  printString(str);
+#ifdef UART_PRINT_BUFFERED
+  TEST_ASSERT_EQ(host_uart.len, UART_PRINT_BUFFER_SIZE);
+  printFlush();
+  TEST_ASSERT_EQ(host_uart.len, sizeof(str) - 1);
+  printFlush(); // nothing to send
+#endif
+  TEST_ASSERT_EQ(host_uart.len, sizeof(str) - 1);
+  TEST_ASSERT_STR(test_captured(), str);
+}
+
+#ifdef UART_PRINT_DMA
+// Only one send_data_start() transfer at a time, data printed meanwhile is sent from printTxComplete()
+void test_dma_deferred(void)
+{
+  test_capture_start();
+  host_uart.defer_complete = true;
+
+  printString("abc");
+  printFlush();
+  TEST_ASSERT_EQ(host_uart.calls, 1);
+  TEST_ASSERT(host_uart.tx_pending);
+  printString("def");
+  printFlush(); // transfer in progress
+  TEST_ASSERT_EQ(host_uart.calls, 1);
+
+  host_uart_complete();
+  TEST_ASSERT_EQ(host_uart.calls, 2);
+  TEST_ASSERT(host_uart.tx_pending);
+  host_uart_complete(); // nothing more to send
+  TEST_ASSERT_EQ(host_uart.calls, 2);
+  TEST_ASSERT(!host_uart.tx_pending);
+
+  printString("g");
+  printFlush();
+  TEST_ASSERT_EQ(host_uart.calls, 3);
+  host_uart_complete();
+  host_uart.defer_complete = false;
+  TEST_ASSERT_STR(test_captured(), "abcdefg");
+}
+#endif
+
+int main(void)
+{
+  host_reset();
+
+  TEST_RUN(test_new_line);
+  TEST_RUN(test_full_buffer);
+
+  TEST_RUN(test_number_boundaries);
+  TEST_RUN(test_number_reciprocal);
+  TEST_RUN(test_number_random);
+
+  TEST_RUN(test_float_random);
+  TEST_RUN(test_float_boundaries);
+  TEST_RUN(test_float_special);
+#ifdef UART_PRINT_DMA
+  TEST_RUN(test_dma_deferred);
+#endif
+
+  return TEST_RESULT();
+}
@@ -0,0 +1,67 @@
+/*
+ * Template library for handling button events (host build).
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ */
+#include "stdint.h"
+
+#include "buttons.h"
+#include "buttons_user.h"
+
+/**
+ * @brief Get simulated milliseconds.
+ * @retval Milliseconds value.
+ */
+uint32_t btn_get_milliseconds(void)
+{
+  return (uint32_t)(host_time_us() / 1000);
+}
+
+/**
+ * @brief Low level call to get actual pin state: fake GPIO input, active low (button to GND, pull-up).
+ * @param cfg: Registered button configuration structure.
+ * @retval BTN_PHY_ACTIVE on button press, BTN_PHY_IDLE otherwise.
+ */
+btn_phy_state_t btn_get_pin_state(btn_cfg_t *cfg)
+{
+  if ((cfg->gpio_port->idr & cfg->gpio_pin) == 0)
+  {
+    return BTN_PHY_ACTIVE;
+  }
+  else
+  {
+    return BTN_PHY_IDLE;
+  }
+}
+
+/**
+ * @brief On press (short, repetitive) button callback: count event.
+ * @param btn: Button configuration structure that triggered the event.
+ */
+void btn_on_press(button_t *btn)
+{
+  (void)btn;
+  host_btn_events.press++;
+}
+
+/**
+ * @brief On press (long) button callback: count event.
+ * @param btn Button configuration structure that triggered the event.
+ */
+void btn_on_longpress(button_t *btn)
+{
+  (void)btn;
+  host_btn_events.longpress++;
+}
+
+/**
+ * @brief On release (short, repetitive or longpress) button callback: count event.
+ * @param btn Button configuration structure that triggered the event.
+ */
+void btn_on_release(button_t *btn)
+{
+  (void)btn;
+  host_btn_events.release++;
+}
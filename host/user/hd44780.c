@@ -0,0 +1,518 @@
+/**
+ ******************************************************************************
+ * File Name          : hd44780.c
+ * Description        : This file provides software model of HD44780 LCD controller
+ *                      for host (PC) builds of LCD library
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "hd44780.h"
+#include "lcd_user.h"
+
+// private functions
+void _hd44780_reset(hd44780_t *lcd);
+void _hd44780_input(hd44780_t *lcd, bool e, bool rs, bool rw, uint8_t d);
+void _hd44780_latch(hd44780_t *lcd);
+void _hd44780_execute(hd44780_t *lcd, bool rs, uint8_t value);
+uint32_t _hd44780_instruction(hd44780_t *lcd, uint8_t cmd);
+void _hd44780_write_data(hd44780_t *lcd, uint8_t data);
+void _hd44780_ac_step(hd44780_t *lcd, bool increment);
+uint8_t _hd44780_data_mask(hd44780_t *lcd);
+void _hd44780_error(hd44780_t *lcd, const char *format, ...);
+
+static hd44780_t *_hd44780_models[HD44780_MAX_MODELS];
+
+/**
+ * @brief Connect model to host GPIO LCD bus (power-up state: 8-bit interface, DDRAM filled with spaces).
+ * @param lcd - model object
+ * @param e_pin - E pin of this LCD on host_gpio_a (HOST_LCD_E_PIN or HOST_LCD_E2_PIN)
+ */
+void hd44780_attach(hd44780_t *lcd, uint32_t e_pin)
+{
+  uint8_t i;
+  int8_t free_slot = -1;
+
+  _hd44780_reset(lcd);
+  lcd->e_pin = e_pin;
+
+  for (i = 0; i < HD44780_MAX_MODELS; i++)
+  {
+    if (_hd44780_models[i] == lcd)
+    {
+      return;
+    }
+    if ((_hd44780_models[i] == NULL) && (free_slot < 0))
+    {
+      free_slot = i;
+    }
+  }
+  if (free_slot >= 0)
+  {
+    _hd44780_models[free_slot] = lcd;
+  }
+}
+
+/**
+ * @brief Connect model to fake I2C bus through PCF8574 expander.
+ * @param lcd - model object
+ * @param address - 7-bit I2C address of expander
+ */
+void hd44780_attach_i2c(hd44780_t *lcd, uint8_t address)
+{
+  hd44780_attach(lcd, 0);
+  lcd->i2c_address = address;
+}
+
+/**
+ * @brief Disconnect all models.
+ */
+void hd44780_detach_all(void)
+{
+  memset(_hd44780_models, 0, sizeof(_hd44780_models));
+}
+
+/**
+ * @brief Sample host GPIO LCD bus, call after each output pin change.
+ */
+void hd44780_bus_update(void)
+{
+  bool rs = (host_gpio_a.odr & HOST_LCD_RS_PIN) != 0;
+  bool rw = (host_gpio_a.odr & HOST_LCD_RW_PIN) != 0;
+  uint8_t d = (uint8_t)host_gpio_b.odr;
+  hd44780_t *lcd;
+  uint8_t mask;
+  uint8_t i;
+
+  for (i = 0; i < HD44780_MAX_MODELS; i++)
+  {
+    lcd = _hd44780_models[i];
+    if ((lcd == NULL) || (lcd->e_pin == 0))
+    {
+      continue;
+    }
+    if (!lcd->e && (host_gpio_a.odr & lcd->e_pin) && rw)
+    { // read starts, LCD drives data pins
+      mask = _hd44780_data_mask(lcd);
+      if ((host_gpio_b.input & mask) != mask)
+      {
+        _hd44780_error(lcd, "bus contention, data pins are outputs while LCD is read");
+      }
+    }
+    _hd44780_input(lcd, (host_gpio_a.odr & lcd->e_pin) != 0, rs, rw, d);
+  }
+}
+
+/**
+ * @brief Set host GPIO data pins inputs (host_gpio_b.idr) as driven by LCD, call before MCU reads them.
+ *        Pins not driven by any LCD are pulled up.
+ */
+void hd44780_bus_read(void)
+{
+  bool connected = false;
+  hd44780_t *lcd;
+  uint8_t value;
+  uint8_t mask;
+  uint8_t i;
+
+  for (i = 0; i < HD44780_MAX_MODELS; i++)
+  {
+    lcd = _hd44780_models[i];
+    if ((lcd == NULL) || (lcd->e_pin == 0))
+    {
+      continue;
+    }
+    if (!connected)
+    { // pull-ups
+      host_gpio_b.idr |= 0xFF;
+      connected = true;
+    }
+    if (!lcd->e || !lcd->rw || lcd->rs)
+    {
+      continue;
+    }
+    // busy flag and address counter, high nibble first in 4-bit mode
+    value = (host_time_us() < lcd->busy_until_us) ? 0x80 : 0x00;
+    value |= lcd->ac & 0x7F;
+    if (!lcd->eight_bit && lcd->low_nibble)
+    {
+      value <<= 4;
+    }
+    mask = _hd44780_data_mask(lcd);
+    host_gpio_b.idr = (host_gpio_b.idr & ~(uint32_t)mask) | (value & mask);
+  }
+}
+
+/**
+ * @brief Output byte of PCF8574 expander, call for each data byte of I2C transaction.
+ * @param address - 7-bit I2C address of transaction
+ * @param data - expander pins P7-P0
+ */
+void hd44780_i2c_write(uint8_t address, uint8_t data)
+{
+  hd44780_t *lcd;
+  uint8_t i;
+
+  for (i = 0; i < HD44780_MAX_MODELS; i++)
+  {
+    lcd = _hd44780_models[i];
+    if ((lcd == NULL) || (lcd->e_pin != 0) || (lcd->i2c_address != address))
+    {
+      continue;
+    }
+    lcd->backlight = (data & 0x08) != 0;
+    _hd44780_input(lcd, (data & 0x04) != 0, (data & 0x01) != 0, (data & 0x02) != 0, data & 0xF0);
+  }
+}
+
+/**
+ * @brief Start measuring bus time and number of transfers of an operation.
+ * @param lcd - model object
+ */
+void hd44780_op_start(hd44780_t *lcd)
+{
+  lcd->op_commands = 0;
+  lcd->op_data = 0;
+  lcd->op_first_us = 0;
+  lcd->op_last_us = 0;
+}
+
+/**
+ * @brief Get bus time of operation: from the first E rising edge since hd44780_op_start() until the last
+ *        transfer is executed by LCD.
+ * @param lcd - model object
+ * @retval Bus time in microseconds, 0 if nothing was sent.
+ */
+uint32_t hd44780_op_bus_time_us(hd44780_t *lcd)
+{
+  if ((lcd->op_first_us == 0) || (lcd->op_last_us < lcd->op_first_us))
+  {
+    return 0;
+  }
+  return (uint32_t)(lcd->op_last_us - lcd->op_first_us);
+}
+
+/**
+ * @brief Get character code displayed at LCD position (DDRAM row addresses 0x00, 0x40, 0x14, 0x54),
+ *        display shift included.
+ * @param lcd - model object
+ * @param row - LCD row
+ * @param col - LCD column
+ * @retval Character code (0 - 7 and 8 - 15 are CGRAM characters)
+ */
+uint8_t hd44780_char_at(hd44780_t *lcd, uint8_t row, uint8_t col)
+{
+  if (lcd->two_line)
+  {
+    return lcd->ddram[((row & 0x01) ? 0x40 : 0x00) + (((row >> 1) * 20 + col + lcd->shift) % 40)];
+  }
+  if (row > 0)
+  {
+    return ' ';
+  }
+  return lcd->ddram[(col + lcd->shift) % 80];
+}
+
+/**
+ * @brief Get displayed row as string, characters that are not printable ASCII (CGRAM) are replaced with '?'.
+ * @param lcd - model object
+ * @param row - LCD row
+ * @param cols - LCD width
+ * @param str - buffer for cols + 1 characters
+ */
+void hd44780_row(hd44780_t *lcd, uint8_t row, uint8_t cols, char *str)
+{
+  uint8_t ch;
+  uint8_t col;
+
+  for (col = 0; col < cols; col++)
+  {
+    ch = hd44780_char_at(lcd, row, col);
+    str[col] = ((ch >= 0x20) && (ch < 0x7F)) ? (char)ch : '?';
+  }
+  str[cols] = '\0';
+}
+
+/**
+ * @brief Print displayed characters to stdout.
+ * @param lcd - model object
+ * @param rows - LCD height
+ * @param cols - LCD width
+ */
+void hd44780_dump(hd44780_t *lcd, uint8_t rows, uint8_t cols)
+{
+  char str[81];
+  uint8_t row;
+
+  for (row = 0; row < rows; row++)
+  {
+    hd44780_row(lcd, row, cols, str);
+    printf("|%s|\n", str);
+  }
+}
+
+// Private functions
+void _hd44780_reset(hd44780_t *lcd)
+{
+  memset(lcd, 0, sizeof(hd44780_t));
+  memset(lcd->ddram, ' ', sizeof(lcd->ddram));
+  lcd->eight_bit = true;
+  lcd->entry_mode = 0x02;
+}
+
+void _hd44780_input(hd44780_t *lcd, bool e, bool rs, bool rw, uint8_t d)
+{
+  uint64_t now = host_time_us();
+  uint8_t mask = _hd44780_data_mask(lcd);
+
+  if (e && !lcd->e)
+  { // rising edge: RS and R/W are sampled, write data must be valid until falling edge
+    if ((lcd->e_rise_us != 0) && ((now - lcd->e_rise_us) < HD44780_E_CYCLE_MIN_US))
+    {
+      _hd44780_error(lcd, "E cycle %u us too short", (unsigned)(now - lcd->e_rise_us));
+    }
+    if (rs && rw)
+    {
+      _hd44780_error(lcd, "data read is not supported");
+    }
+    lcd->e_rise_us = now;
+    lcd->rs = rs;
+    lcd->rw = rw;
+    lcd->d = d;
+    if (lcd->op_first_us == 0)
+    {
+      lcd->op_first_us = now;
+    }
+  }
+  else if (e && lcd->e)
+  {
+    if ((rs != lcd->rs) || (rw != lcd->rw) || (!rw && ((d & mask) != (lcd->d & mask))))
+    {
+      _hd44780_error(lcd, "bus changed while E is high");
+    }
+  }
+  else if (!e && lcd->e)
+  { // falling edge: data is latched (write) or read cycle ends
+    if ((now - lcd->e_rise_us) < HD44780_E_PULSE_MIN_US)
+    {
+      _hd44780_error(lcd, "E pulse %u us too short", (unsigned)(now - lcd->e_rise_us));
+    }
+    if (lcd->rw)
+    {
+      if (!lcd->eight_bit)
+      {
+        lcd->low_nibble = !lcd->low_nibble;
+      }
+    }
+    else
+    {
+      _hd44780_latch(lcd);
+    }
+  }
+  lcd->e = e;
+}
+
+void _hd44780_latch(hd44780_t *lcd)
+{
+  uint64_t now = host_time_us();
+
+  if (now < lcd->busy_until_us)
+  {
+    _hd44780_error(lcd, "%s written while busy, %u us before execution end", lcd->rs ? "data" : "command",
+                   (unsigned)(lcd->busy_until_us - now));
+  }
+  if (lcd->eight_bit)
+  {
+    _hd44780_execute(lcd, lcd->rs, lcd->d);
+  }
+  else if (!lcd->low_nibble)
+  {
+    lcd->high = lcd->d & 0xF0;
+    lcd->low_nibble = true;
+  }
+  else
+  {
+    lcd->low_nibble = false;
+    _hd44780_execute(lcd, lcd->rs, lcd->high | (lcd->d >> 4));
+  }
+}
+
+void _hd44780_execute(hd44780_t *lcd, bool rs, uint8_t value)
+{
+  uint32_t exec_us = HD44780_EXEC_US;
+
+  if (rs)
+  {
+    _hd44780_write_data(lcd, value);
+    lcd->data++;
+    lcd->op_data++;
+  }
+  else
+  {
+    exec_us = _hd44780_instruction(lcd, value);
+    lcd->commands++;
+    lcd->op_commands++;
+  }
+  lcd->busy_until_us = host_time_us() + exec_us;
+  lcd->op_last_us = lcd->busy_until_us;
+}
+
+// Execute instruction, returns execution time
+uint32_t _hd44780_instruction(hd44780_t *lcd, uint8_t cmd)
+{
+  uint8_t line_len = lcd->two_line ? 40 : 80;
+  uint32_t exec_us = HD44780_EXEC_US;
+
+  if (cmd & 0x80)
+  { // set DDRAM address
+    lcd->ac = cmd & 0x7F;
+    lcd->cgram_mode = false;
+    if ((lcd->two_line && ((lcd->ac & 0x3F) >= 40)) || (!lcd->two_line && (lcd->ac >= 80)))
+    {
+      _hd44780_error(lcd, "DDRAM address 0x%02X out of range", lcd->ac);
+    }
+  }
+  else if (cmd & 0x40)
+  { // set CGRAM address
+    lcd->ac = cmd & 0x3F;
+    lcd->cgram_mode = true;
+  }
+  else if (cmd & 0x20)
+  { // function set: interface data length, number of lines
+    if (cmd & 0x10)
+    {
+      if (lcd->reset_step == 0)
+      {
+        exec_us = HD44780_RESET_FIRST_US;
+      }
+      else if (lcd->reset_step == 1)
+      {
+        exec_us = HD44780_RESET_SECOND_US;
+      }
+    }
+    if (lcd->reset_step < 2)
+    {
+      lcd->reset_step++;
+    }
+    lcd->eight_bit = (cmd & 0x10) != 0;
+    lcd->low_nibble = false;
+    lcd->two_line = (cmd & 0x08) != 0;
+  }
+  else if (cmd & 0x10)
+  { // cursor or display shift
+    if (cmd & 0x08)
+    {
+      lcd->shift = (cmd & 0x04) ? (lcd->shift + line_len - 1) % line_len : (lcd->shift + 1) % line_len;
+    }
+    else
+    {
+      _hd44780_ac_step(lcd, (cmd & 0x04) != 0);
+    }
+  }
+  else if (cmd & 0x08)
+  { // display on/off control
+    lcd->display_ctrl = cmd & 0x07;
+  }
+  else if (cmd & 0x04)
+  { // entry mode set
+    lcd->entry_mode = cmd & 0x03;
+  }
+  else if (cmd & 0x02)
+  { // return home
+    lcd->ac = 0;
+    lcd->shift = 0;
+    lcd->cgram_mode = false;
+    exec_us = HD44780_CLEAR_US;
+  }
+  else if (cmd & 0x01)
+  { // clear display
+    memset(lcd->ddram, ' ', sizeof(lcd->ddram));
+    lcd->ac = 0;
+    lcd->shift = 0;
+    lcd->cgram_mode = false;
+    lcd->entry_mode |= 0x02;
+    exec_us = HD44780_CLEAR_US;
+  }
+  return exec_us;
+}
+
+void _hd44780_write_data(hd44780_t *lcd, uint8_t data)
+{
+  uint8_t line_len = lcd->two_line ? 40 : 80;
+
+  if (lcd->cgram_mode)
+  {
+    lcd->cgram[lcd->ac & 0x3F] = data & 0x1F;
+  }
+  else
+  {
+    lcd->ddram[lcd->ac & 0x7F] = data;
+    if (lcd->entry_mode & 0x01)
+    { // display shifts with cursor
+      lcd->shift = (lcd->entry_mode & 0x02) ? (lcd->shift + 1) % line_len : (lcd->shift + line_len - 1) % line_len;
+    }
+  }
+  _hd44780_ac_step(lcd, (lcd->entry_mode & 0x02) != 0);
+}
+
+void _hd44780_ac_step(hd44780_t *lcd, bool increment)
+{
+  if (lcd->cgram_mode)
+  {
+    lcd->ac = (increment ? lcd->ac + 1 : lcd->ac - 1) & 0x3F;
+  }
+  else if (lcd->two_line)
+  { // 0x00 - 0x27 and 0x40 - 0x67
+    if (increment)
+    {
+      lcd->ac = (lcd->ac == 0x27) ? 0x40 : (lcd->ac == 0x67) ? 0x00 : lcd->ac + 1;
+    }
+    else
+    {
+      lcd->ac = (lcd->ac == 0x40) ? 0x27 : (lcd->ac == 0x00) ? 0x67 : lcd->ac - 1;
+    }
+  }
+  else
+  { // 0x00 - 0x4F
+    if (increment)
+    {
+      lcd->ac = (lcd->ac >= 0x4F) ? 0x00 : lcd->ac + 1;
+    }
+    else
+    {
+      lcd->ac = (lcd->ac == 0x00) ? 0x4F : lcd->ac - 1;
+    }
+  }
+}
+
+// Data pins used by current interface: D0-D7, or D4-D7 in 4-bit mode
+uint8_t _hd44780_data_mask(hd44780_t *lcd)
+{
+  return lcd->eight_bit ? 0xFF : 0xF0;
+}
+
+void _hd44780_error(hd44780_t *lcd, const char *format, ...)
+{
+  va_list args;
+
+  va_start(args, format);
+  vsnprintf(lcd->error, sizeof(lcd->error), format, args);
+  va_end(args);
+  lcd->errors++;
+
+  if (lcd->e_pin)
+  {
+    printf("hd44780 E 0x%X, %llu us: %s\n", (unsigned)lcd->e_pin, (unsigned long long)host_time_us(), lcd->error);
+  }
+  else
+  {
+    printf("hd44780 I2C 0x%02X, %llu us: %s\n", lcd->i2c_address, (unsigned long long)host_time_us(), lcd->error);
+  }
+}
@@ -0,0 +1,111 @@
+/**
+ ******************************************************************************
+ * File Name          : hd44780.h
+ * Description        : This file provides software model of HD44780 LCD controller
+ *                      for host (PC) builds of LCD library
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+ *
+ * Model is connected to fake GPIO bus of host lcd_user.c (D0-D7 = port B pins 0-7, RS, R/W and E on port A,
+ * see lcd_user.h), or to fake I2C bus through PCF8574 expander (P0 = RS, P1 = R/W, P2 = E, P3 = backlight,
+ * P4-P7 = D4-D7). It decodes 8-bit and 4-bit transfers (interface length is set by function set command, as
+ * on real controller after power-up), keeps DDRAM, CGRAM, address counter, entry mode and display shift, and
+ * drives data pins when busy flag and address counter are read.
+ *
+ * Timing errors (counted in errors, last one is kept in error string):
+ *  - E pulse shorter than HD44780_E_PULSE_MIN_US or E cycle shorter than HD44780_E_CYCLE_MIN_US
+ *  - RS, R/W or written data changed while E is high
+ *  - transfer latched before previous instruction is executed (clear/home 1.52 ms, others 37 us,
+ *    4.1 ms and 100 us after the first two function sets of reset sequence)
+ *  - data pins driven by MCU while LCD drives them (busy flag read)
+ *  - DDRAM address out of range
+ *
+ * Usage:
+ *  hd44780_t model;
+ *  hd44780_attach(&model, HOST_LCD_E_PIN); // or hd44780_attach_i2c(&model, LCD_PCF8574_ADDRESS)
+ *  lcd_init(&lcd, 4, 20);
+ *  hd44780_op_start(&model);
+ *  lcd_print_str(&lcd, 0, 0, "Hello");
+ *  hd44780_row(&model, 0, 20, row_text);  // visible characters of row 0
+ *  hd44780_op_bus_time_us(&model); // bus time of lcd_print_str()
+ */
+
+#ifndef __HD44780_H
+#define __HD44780_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "host.h"
+
+#define HD44780_MAX_MODELS 4 // number of attached models (LCDs)
+
+#define HD44780_E_PULSE_MIN_US 1 // 450 ns
+#define HD44780_E_CYCLE_MIN_US 1 // 1000 ns
+#define HD44780_EXEC_US 37
+#define HD44780_CLEAR_US 1520
+#define HD44780_RESET_FIRST_US 4100  // after first function set of reset sequence
+#define HD44780_RESET_SECOND_US 100  // after second function set of reset sequence
+
+#define HD44780_DDRAM_SIZE 0x80
+#define HD44780_CGRAM_SIZE 0x40
+
+typedef struct
+{
+  // connection
+  uint32_t e_pin;      // E pin on host_gpio_a, 0 if connected through PCF8574
+  uint8_t i2c_address; // PCF8574 address
+
+  // bus
+  bool e;
+  bool rs;           // RS at E rising edge
+  bool rw;           // R/W at E rising edge
+  uint8_t d;         // data pins at E rising edge (write)
+  uint64_t e_rise_us;
+  bool eight_bit;    // interface data length
+  bool low_nibble;   // 4-bit mode: next transfer is low nibble
+  uint8_t high;      // 4-bit mode: received high nibble
+  uint8_t reset_step; // number of function sets of reset sequence
+
+  // controller
+  uint8_t ddram[HD44780_DDRAM_SIZE];
+  uint8_t cgram[HD44780_CGRAM_SIZE];
+  uint8_t ac;        // address counter
+  bool cgram_mode;   // data is written to CGRAM
+  bool two_line;
+  uint8_t entry_mode;   // I/D (0x02), S (0x01)
+  uint8_t display_ctrl; // D (0x04), C (0x02), B (0x01)
+  uint8_t shift;        // display shift, number of positions moved left
+  bool backlight;       // PCF8574 P3
+  uint64_t busy_until_us;
+
+  // statistics
+  uint32_t commands;
+  uint32_t data;
+  uint32_t errors;
+  char error[96];
+  uint32_t op_commands; // since hd44780_op_start()
+  uint32_t op_data;
+  uint64_t op_first_us; // first E rising edge since hd44780_op_start(), 0 if none
+  uint64_t op_last_us;  // end of execution of the last transfer
+} hd44780_t;
+
+void hd44780_attach(hd44780_t *lcd, uint32_t e_pin);
+void hd44780_attach_i2c(hd44780_t *lcd, uint8_t address);
+void hd44780_detach_all(void);
+
+void hd44780_bus_update(void);
+void hd44780_bus_read(void);
+void hd44780_i2c_write(uint8_t address, uint8_t data);
+
+void hd44780_op_start(hd44780_t *lcd);
+uint32_t hd44780_op_bus_time_us(hd44780_t *lcd);
+
+uint8_t hd44780_char_at(hd44780_t *lcd, uint8_t row, uint8_t col);
+void hd44780_row(hd44780_t *lcd, uint8_t row, uint8_t cols, char *str);
+void hd44780_dump(hd44780_t *lcd, uint8_t rows, uint8_t cols);
+
+#endif /* __HD44780_H */
@@ -0,0 +1,77 @@
+/**
+ ******************************************************************************
+ * File Name          : host.c
+ * Description        : This file provides fake hardware (simulated time, GPIO ports,
+ *                      UART and I2C bus) for host (PC) builds of libraries
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+ */
+
+#include <string.h>
+
+#include "host.h"
+
+host_gpio_t host_gpio_a;
+host_gpio_t host_gpio_b;
+host_uart_t host_uart;
+host_i2c_t host_i2c;
+host_btn_events_t host_btn_events;
+
+static uint64_t _host_time_us = HOST_TIME_START_US;
+
+/**
+ * @brief Reset all fake hardware to its initial state (pins low, outputs, empty captures, initial time).
+ * @retval None
+ */
+void host_reset(void)
+{
+  memset(&host_gpio_a, 0, sizeof(host_gpio_a));
+  memset(&host_gpio_b, 0, sizeof(host_gpio_b));
+  memset(&host_uart, 0, sizeof(host_uart));
+  memset(&host_i2c, 0, sizeof(host_i2c));
+  memset(&host_btn_events, 0, sizeof(host_btn_events));
+  _host_time_us = HOST_TIME_START_US;
+}
+
+/**
+ * @brief Get simulated time.
+ * @retval Microseconds since simulation start (HOST_TIME_START_US at start).
+ */
+uint64_t host_time_us(void)
+{
+  return _host_time_us;
+}
+
+/**
+ * @brief Advance simulated time.
+ * @param us - number of microseconds
+ * @retval None
+ */
+void host_advance_us(uint64_t us)
+{
+  _host_time_us += us;
+}
+
+/**
+ * @brief Append sent UART data to capture buffer (data beyond HOST_UART_CAPTURE_SIZE is only counted).
+ * @param data - sent data
+ * @param size - number of bytes
+ * @retval None
+ */
+void host_uart_capture(const uint8_t *data, uint16_t size)
+{
+  uint16_t i;
+
+  for (i = 0; i < size; i++)
+  {
+    if (host_uart.len < HOST_UART_CAPTURE_SIZE)
+    {
+      host_uart.data[host_uart.len] = (char)data[i];
+    }
+    host_uart.len++;
+  }
+  host_uart.calls++;
+}
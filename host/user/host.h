@@ -0,0 +1,87 @@
+/**
+ ******************************************************************************
+ * File Name          : host.h
+ * Description        : This file provides fake hardware (simulated time, GPIO ports,
+ *                      UART and I2C bus) for host (PC) builds of libraries
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+*/
+
+#ifndef __HOST_H
+#define __HOST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HOST_PIN(n) (1UL << (n)) // pin mask, like GPIO_PIN_n on STM32
+
+// Fake GPIO port
+typedef struct
+{
+  uint32_t odr;   // output pin states (lcd_write_pin(), lcd_write_data_pins())
+  uint32_t idr;   // input pin states, set by tests (buttons, rotary encoder) or by LCD model
+  uint32_t input; // pins configured as inputs (lcd_set_pin_input())
+} host_gpio_t;
+
+extern host_gpio_t host_gpio_a;
+extern host_gpio_t host_gpio_b;
+
+// Simulated time, advanced only by user delay functions and by tests. Starts at 1 s: buttons library uses
+// timestamp 0 as "not tracked".
+#define HOST_TIME_START_US 1000000
+
+// Fake UART (send_data(), send_data_start())
+#define HOST_UART_CAPTURE_SIZE 4096
+
+typedef struct
+{
+  char data[HOST_UART_CAPTURE_SIZE]; // captured output (first HOST_UART_CAPTURE_SIZE bytes), not zero terminated
+  uint32_t len;                      // number of all sent bytes
+  uint32_t calls;                    // number of send_data()/send_data_start() calls
+  bool defer_complete;               // false: send_data_start() transfer finishes immediately
+  bool tx_pending;                   // send_data_start() transfer waits for host_uart_complete()
+} host_uart_t;
+
+extern host_uart_t host_uart;
+
+// Fake I2C bus (lcd_i2c_write())
+#define HOST_I2C_LOG_SIZE 256
+
+typedef struct
+{
+  uint64_t time_us; // simulated time at transaction start
+  uint8_t address;  // 7-bit device address
+  uint16_t len;     // number of data bytes
+} host_i2c_transfer_t;
+
+typedef struct
+{
+  host_i2c_transfer_t log[HOST_I2C_LOG_SIZE]; // first HOST_I2C_LOG_SIZE transactions
+  uint32_t transactions;                      // number of lcd_i2c_write() calls
+  uint32_t bytes;                             // number of data bytes in all transactions
+} host_i2c_t;
+
+extern host_i2c_t host_i2c;
+
+// Fake button callbacks (btn_on_press(), btn_on_longpress(), btn_on_release())
+typedef struct
+{
+  uint32_t press;
+  uint32_t longpress;
+  uint32_t release;
+} host_btn_events_t;
+
+extern host_btn_events_t host_btn_events;
+
+void host_reset(void);
+
+uint64_t host_time_us(void);
+void host_advance_us(uint64_t us);
+
+void host_uart_capture(const uint8_t *data, uint16_t size);
+void host_uart_complete(void); // defined in uart_print_user.c
+
+#endif /* __HOST_H */
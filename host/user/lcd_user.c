@@ -0,0 +1,166 @@
+/**
+ ******************************************************************************
+ * File Name          : lcd_user.c
+ * Description        : This file provides code for the configuration
+ *                      of HD44780 based LCD (host build)
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+ */
+
+/* Includes -------------------------------------*/
+#include "lcd_user.h"
+
+#include "hd44780.h"
+
+host_lcd_stats_t host_lcd_stats;
+
+/**
+ * @brief Host implementation of microsecond delay: advance simulated time.
+ * @param Microseconds to delay
+ * @retval None
+ */
+void lcd_delay_us(uint32_t uSec)
+{
+  host_lcd_stats.delays++;
+  host_advance_us(uSec);
+}
+
+/**
+ * @brief Host implementation of miliseconds delay: advance simulated time.
+ * @param Miliseconds to delay
+ * @retval None
+ */
+void lcd_delay_ms(uint32_t mSec)
+{
+  host_lcd_stats.delays++;
+  host_advance_us((uint64_t)mSec * 1000);
+}
+
+/**
+ * @brief Get simulated milliseconds.
+ * @retval Milliseconds value, overflow is allowed.
+ */
+uint32_t lcd_get_ms(void)
+{
+  return (uint32_t)(host_time_us() / 1000);
+}
+
+/**
+ * @brief Get simulated microseconds.
+ * @retval Microseconds value, overflow is allowed.
+ */
+uint32_t lcd_get_us(void)
+{
+  return (uint32_t)host_time_us();
+}
+
+/**
+ * @brief Host implementation of GPIO initialization.
+ * @retval None
+ */
+void lcd_init_pins(void)
+{
+  // fake GPIO pins are outputs after host_reset()
+}
+
+/**
+ * @brief Host implementation of GPIO output pin write-function, LCD models sample the bus.
+ * @param GPIO port
+ * @param GPIO pin
+ * @param GPIO new output state
+ * @retval None
+ */
+void lcd_write_pin(LCD_GPIO_PORT_TYPE *port, LCD_GPIO_PIN_TYPE pin, bool state)
+{
+  host_lcd_stats.pin_writes++;
+  if (state)
+  {
+    port->odr |= pin;
+  }
+  else
+  {
+    port->odr &= ~pin;
+  }
+  hd44780_bus_update();
+}
+
+/**
+ * @brief Host implementation of all data pins write: D0-D7 are pins 0-7 of port.
+ * @param GPIO port of D7 pin (LCD bus)
+ * @param Data pins D7-D0 states (bit 7 = D7). In 4-bit mode, D0-D3 are not connected.
+ * @retval None
+ */
+void lcd_write_data_pins(LCD_GPIO_PORT_TYPE *port, uint8_t value)
+{
+  host_lcd_stats.pin_writes++;
+  port->odr = (port->odr & ~0xFFUL) | value;
+  hd44780_bus_update();
+}
+
+/**
+ * @brief Host implementation of GPIO input pin read-function.
+ * @param GPIO port
+ * @param GPIO pin
+ * @retval GPIO input state (output state if pin is not configured as input)
+ */
+bool lcd_read_pin(LCD_GPIO_PORT_TYPE *port, LCD_GPIO_PIN_TYPE pin)
+{
+  host_lcd_stats.pin_reads++;
+  hd44780_bus_read();
+  if (port->input & pin)
+  {
+    return (port->idr & pin) != 0;
+  }
+  return (port->odr & pin) != 0;
+}
+
+/**
+ * @brief Host implementation of GPIO pin direction switch.
+ * @param GPIO port
+ * @param GPIO pin
+ * @param true to configure pin as input (LCD read), false to configure it back as output.
+ * @retval None
+ */
+void lcd_set_pin_input(LCD_GPIO_PORT_TYPE *port, LCD_GPIO_PIN_TYPE pin, bool input)
+{
+  if (input)
+  {
+    port->input |= pin;
+  }
+  else
+  {
+    port->input &= ~pin;
+  }
+}
+
+/**
+ * @brief Host implementation of I2C write: log transaction and send expander bytes to LCD model,
+ *        simulated time advances by bus time of each byte.
+ * @param 7-bit I2C device address
+ * @param Pointer to data to send
+ * @param Number of bytes to send
+ * @retval None
+ */
+void lcd_i2c_write(uint8_t address, const uint8_t *data, uint16_t len)
+{
+  uint16_t i;
+
+  if (host_i2c.transactions < HOST_I2C_LOG_SIZE)
+  {
+    host_i2c.log[host_i2c.transactions].time_us = host_time_us();
+    host_i2c.log[host_i2c.transactions].address = address;
+    host_i2c.log[host_i2c.transactions].len = len;
+  }
+  host_i2c.transactions++;
+  host_i2c.bytes += len;
+
+  host_advance_us(HOST_I2C_BYTE_US); // address byte
+  for (i = 0; i < len; i++)
+  { // expander outputs change after each data byte
+    host_advance_us(HOST_I2C_BYTE_US);
+    hd44780_i2c_write(address, data[i]);
+  }
+}
@@ -0,0 +1,88 @@
+/**
+ ******************************************************************************
+ * File Name          : lcd_user.h
+ * Description        : This file provides code for the configuration
+ *                      of HD44780 based LCD (host build)
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+*/
+
+#ifndef __LCD_USER_H
+#define __LCD_USER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "host.h"
+
+// define GPIO port/pin object type
+#define LCD_GPIO_PORT_TYPE host_gpio_t
+#define LCD_GPIO_PIN_TYPE uint32_t
+
+// Options (LCD_8BIT_MODE, LCD_USE_PORT_WRITE, LCD_GO_TO_NEW_LINE_IF_STRING_TOO_LONG, LCD_USE_FRAMEBUFFER,
+// LCD_USE_GLYPH_CACHE, LCD_ASYNC, LCD_USE_PCF8574, LCD_USE_BUSY_FLAG) are set by build (host/CMakeLists.txt).
+
+#ifndef LCD_WINDOW_PRINT_DELAY_MS
+#define LCD_WINDOW_PRINT_DELAY_MS 800 // delay between static view and window scrolling (used in LCD_PrintStringWindow();)
+#endif
+#ifndef LCD_MAX_MARQUEES
+#define LCD_MAX_MARQUEES 4 // maximum number of non-blocking scrolling regions started at the same time
+#endif
+
+#ifndef LCD_MAX_ROWS
+#define LCD_MAX_ROWS 4 // framebuffer size: maximum number of LCD rows
+#endif
+#ifndef LCD_MAX_COLS
+#define LCD_MAX_COLS 20 // framebuffer size: maximum number of LCD columns
+#endif
+
+#ifndef LCD_MAX_GLYPHS
+#define LCD_MAX_GLYPHS 16 // number of custom characters that can be registered (IDs 1 - LCD_MAX_GLYPHS)
+#endif
+
+#ifndef LCD_ASYNC_QUEUE_SIZE
+#define LCD_ASYNC_QUEUE_SIZE 256 // number of queued transfers (characters, commands, delays)
+#endif
+
+#ifndef LCD_PCF8574_ADDRESS
+#define LCD_PCF8574_ADDRESS 0x27 // default 7-bit I2C address of PCF8574 (0x3F for PCF8574A), if not set in lcd_t
+#endif
+#ifndef LCD_PCF8574_BUFFER_SIZE
+#define LCD_PCF8574_BUFFER_SIZE (4 * (LCD_MAX_COLS + 1)) // I2C transaction: 4 bytes per character, row + cursor command
+#endif
+
+// Host LCD connection: D0-D7 = port B pins 0-7, RS = port A pin 8, R/W = port A pin 9, E = port A pin 10
+// (second LCD on the same bus: port A pin 11). lcd_write_data_pins() relies on data pins 0-7 of one port.
+#define HOST_LCD_RS_PIN HOST_PIN(8)
+#define HOST_LCD_RW_PIN HOST_PIN(9)
+#define HOST_LCD_E_PIN HOST_PIN(10)
+#define HOST_LCD_E2_PIN HOST_PIN(11)
+
+#define HOST_I2C_BYTE_US 90 // PCF8574 at 100 kHz: 8 data bits + ACK per byte
+
+// LCD bus activity counters, for benchmarks
+typedef struct
+{
+  uint32_t pin_writes;  // lcd_write_pin() and lcd_write_data_pins() calls
+  uint32_t pin_reads;   // lcd_read_pin() calls
+  uint32_t delays;      // lcd_delay_us() and lcd_delay_ms() calls
+} host_lcd_stats_t;
+
+extern host_lcd_stats_t host_lcd_stats;
+
+void lcd_delay_us(uint32_t uSec);
+void lcd_delay_ms(uint32_t mSec);
+uint32_t lcd_get_us(void);
+uint32_t lcd_get_ms(void);
+
+void lcd_init_pins(void);
+void lcd_write_pin(LCD_GPIO_PORT_TYPE *port, LCD_GPIO_PIN_TYPE pin, bool state);
+void lcd_write_data_pins(LCD_GPIO_PORT_TYPE *port, uint8_t value);
+bool lcd_read_pin(LCD_GPIO_PORT_TYPE *port, LCD_GPIO_PIN_TYPE pin);
+void lcd_set_pin_input(LCD_GPIO_PORT_TYPE *port, LCD_GPIO_PIN_TYPE pin, bool input);
+void lcd_i2c_write(uint8_t address, const uint8_t *data, uint16_t len);
+
+#endif /* __LCD_USER_H */
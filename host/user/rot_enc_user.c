@@ -0,0 +1,22 @@
+/**
+ ******************************************************************************
+ * File Name          : rot_enc_user.c
+ * Description        : This file provides code for handling rotary encoder (host build)
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+ */
+#include "rot_enc_user.h"
+
+/**
+ * @brief Host implementation of GPIO pin read function: fake GPIO input.
+ * @param GPIO port
+ * @param GPIO pin
+ * @retval bool (0 if pin state is logical low, 1 if pin state is logical high)
+ */
+bool rot_enc_read_pin(ROT_ENC_GPIO_PORT_TYPE *port, ROT_ENC_GPIO_PIN_TYPE pin)
+{
+  return (port->idr & pin) != 0;
+}
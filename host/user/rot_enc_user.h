@@ -0,0 +1,25 @@
+/**
+ ******************************************************************************
+ * File Name          : rot_enc_user.h
+ * Description        : This file provides code for handling rotary encoder (host build)
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic, Damogran Labs
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ * @version v1.0
+ */
+#ifndef __ROT_ENC_USER_H
+#define __ROT_ENC_USER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "host.h"
+
+#define ROT_ENC_GPIO_PORT_TYPE host_gpio_t
+#define ROT_ENC_GPIO_PIN_TYPE uint32_t
+#define ROT_ENC_GPIO_PIN_STATE_TYPE bool
+
+bool rot_enc_read_pin(ROT_ENC_GPIO_PORT_TYPE *port, ROT_ENC_GPIO_PIN_TYPE pin);
+
+#endif
@@ -0,0 +1,51 @@
+/*
+ * Template library for creating an Arduino-like UART print API (host build).
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ */
+
+#include "uart_print.h"
+#include "uart_print_user.h"
+
+/**
+ * @brief Send data over fake UART: capture it.
+ * @param pointer to a data
+ * @param size of data (number of bytes to send
+ * @retval None
+ */
+void send_data(uint8_t *data, uint16_t size)
+{
+  host_uart_capture(data, size);
+}
+
+/**
+ * @brief Start non-blocking transfer of data over fake UART: capture it and finish transfer immediately,
+ *        or (host_uart.defer_complete) when test calls host_uart_complete().
+ * @param pointer to a data, valid until printTxComplete() is called
+ * @param size of data (number of bytes to send)
+ * @retval None
+ */
+void send_data_start(uint8_t *data, uint16_t size)
+{
+  host_uart_capture(data, size);
+  host_uart.tx_pending = true;
+  if (!host_uart.defer_complete)
+  {
+    host_uart_complete();
+  }
+}
+
+/**
+ * @brief Finish pending send_data_start() transfer, as DMA transfer complete interrupt would.
+ * @retval None
+ */
+void host_uart_complete(void)
+{
+  if (host_uart.tx_pending)
+  {
+    host_uart.tx_pending = false;
+    printTxComplete();
+  }
+}
@@ -0,0 +1,26 @@
+/*
+ * Template library for creating an Arduino-like UART print API (host build).
+ * @date    16-Oct-2026
+ * @author  Domen Jurkovic
+ * @source  http://damogranlabs.com/
+ *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
+ *
+ */
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef __UART_PRINT_USER_H
+#define __UART_PRINT_USER_H
+
+/* Includes ------------------------------------------------------------------*/
+#include "stdint.h"
+
+#include "host.h"
+
+// Options (UART_PRINT_BUFFERED, UART_PRINT_DMA) are set by build (host/CMakeLists.txt).
+#ifndef UART_PRINT_BUFFER_SIZE
+#define UART_PRINT_BUFFER_SIZE 128 // output buffer size in bytes (UART_PRINT_BUFFERED)
+#endif
+
+void send_data(uint8_t *data, uint16_t size);
+void send_data_start(uint8_t *data, uint16_t size);
+
+#endif
@@ -3,16 +3,26 @@
  * File Name          : lcd_user.c
  * Description        : This file provides code for the configuration
  *                      of HD44780 based LCD
- * @date    13-Feb-2021
+ * @date    16-Oct-2026
  * @author  Domen Jurkovic, Damogran Labs
  * @source  http://damogranlabs.com/
  *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
- * @version v1.4
+ * @version v2.0
  */
 
 /* Includes -------------------------------------*/
 #include "lcd_user.h"
 
+#ifdef LCD_ASYNC
+#include "stm32f0xx_ll_tim.h"
+#endif
+
+#ifdef LCD_USE_PCF8574
+#include "stm32f0xx_hal.h"
+
+extern I2C_HandleTypeDef hi2c1;
+#endif
+
 #pragma GCC push_options
 #pragma GCC optimize("O0")
 /**
@@ -41,6 +51,28 @@ void lcd_delay_ms(uint32_t mSec)
   HAL_Delay(mSec);
 }
 
+/**
+ * @brief Get current system milliseconds (systick) value (used by non-blocking marquee scrolling).
+ * @retval Milliseconds value, overflow is allowed.
+ */
+uint32_t lcd_get_ms(void)
+{
+  return HAL_GetTick();
+}
+
+#ifdef LCD_ASYNC
+/**
+ * @brief Microcontroller-specific implementation of free-running microseconds counter (used only with LCD_ASYNC).
+ * @retval Microseconds value, overflow is allowed.
+ * @note Example with 32-bit TIM2 counting at 1 MHz (prescaler SystemCoreClock / 1000000 - 1, auto-reload
+ *       0xFFFFFFFF), configured and started before lcd_init().
+ */
+uint32_t lcd_get_us(void)
+{
+  return LL_TIM_GetCounter(TIM2);
+}
+#endif
+
 /**
  * @brief Microcontroller-specific implementation of GPIO initialization.
  * @retval None
@@ -68,3 +100,63 @@ void lcd_write_pin(LCD_GPIO_PORT_TYPE *port, LCD_GPIO_PIN_TYPE pin, bool state)
     LL_GPIO_ResetOutputPin(port, pin);
   }
 }
+
+/**
+ * @brief Microcontroller-specific implementation of all data pins write (used only with LCD_USE_PORT_WRITE).
+ * @param GPIO port of D7 pin (LCD bus)
+ * @param Data pins D7-D0 states (bit 7 = D7). In 4-bit mode, only high nibble (D7-D4) is used.
+ * @retval None
+ * @note Example for D0(D4)-D7 connected to pins 0(4)-7 of the same port: all data pins are set and reset with
+ *       a single BSRR write (bits 0-15 set pins, bits 16-31 reset pins). Masks and shifts depend on actual
+ *       data pins connection.
+ */
+void lcd_write_data_pins(LCD_GPIO_PORT_TYPE *port, uint8_t value)
+{
+#ifdef LCD_8BIT_MODE
+  uint32_t mask = 0xFF;
+#else
+  uint32_t mask = 0xF0;
+#endif
+
+  WRITE_REG(port->BSRR, ((~value & mask) << 16) | (value & mask));
+}
+
+/**
+ * @brief Microcontroller-specific implementation of GPIO input pin read-function (used only with LCD_USE_BUSY_FLAG).
+ * @param GPIO port
+ * @param GPIO pin
+ * @retval GPIO input state
+ */
+bool lcd_read_pin(LCD_GPIO_PORT_TYPE *port, LCD_GPIO_PIN_TYPE pin)
+{
+  return (bool)LL_GPIO_IsInputPinSet(port, pin);
+}
+
+/**
+ * @brief Microcontroller-specific implementation of GPIO pin direction switch (used only with LCD_USE_BUSY_FLAG,
+ *        for data pins D4-D7, or D0-D7 in 8-bit mode).
+ * @param GPIO port
+ * @param GPIO pin
+ * @param true to configure pin as input (LCD read), false to configure it back as output.
+ * @retval None
+ * @note 5V LCD drives data pins with 5V when reading - MCU pins must be 5V tolerant.
+ */
+void lcd_set_pin_input(LCD_GPIO_PORT_TYPE *port, LCD_GPIO_PIN_TYPE pin, bool input)
+{
+  LL_GPIO_SetPinMode(port, pin, input ? LL_GPIO_MODE_INPUT : LL_GPIO_MODE_OUTPUT);
+}
+
+#ifdef LCD_USE_PCF8574
+/**
+ * @brief Microcontroller-specific implementation of I2C write (used only with LCD_USE_PCF8574).
+ * @param 7-bit I2C device address
+ * @param Pointer to data to send
+ * @param Number of bytes to send - all bytes must be sent in a single I2C transaction.
+ * @retval None
+ * @note I2C must be initialized in lcd_init_pins() or before lcd_init(). PCF8574 supports up to 100 kHz.
+ */
+void lcd_i2c_write(uint8_t address, const uint8_t *data, uint16_t len)
+{
+  HAL_I2C_Master_Transmit(&hi2c1, (uint16_t)(address << 1), (uint8_t *)data, len, HAL_MAX_DELAY);
+}
+#endif
@@ -3,11 +3,11 @@
  * File Name          : lcd_user.h
  * Description        : This file provides code for the configuration
  *                      of HD44780 based LCD
- * @date    13-Feb-2021
+ * @date    16-Oct-2026
  * @author  Domen Jurkovic, Damogran Labs
  * @source  http://damogranlabs.com/
  *          https://github.com/damogranlabs/Embedded-device-utilities-in-C
- * @version v1.4
+ * @version v2.0
 */
 
 #ifndef __LCD_USER_H
@@ -22,27 +22,41 @@
 #define LCD_GPIO_PORT_TYPE GPIO_TypeDef
 #define LCD_GPIO_PIN_TYPE uint32_t
 
-#define LCD_D4_GPIO_Port GPIOB
-#define LCD_D4_Pin GPIO_PIN_4
-#define LCD_D5_GPIO_Port GPIOB
-#define LCD_D5_Pin GPIO_PIN_5
-#define LCD_D6_GPIO_Port GPIOB
-#define LCD_D6_Pin GPIO_PIN_6
-#define LCD_D7_GPIO_Port GPIOB
-#define LCD_D7_Pin GPIO_PIN_7
+//#define LCD_8BIT_MODE // uncomment if LCD D0-D7 are connected (8-bit interface), otherwise only D4-D7 are used
+//#define LCD_USE_PORT_WRITE // uncomment to set all data pins with single lcd_write_data_pins() call
 
-#define LCD_RS_GPIO_Port GPIOA
-#define LCD_RS_Pin GPIO_PIN_8
-#define LCD_E_GPIO_Port GPIOA
-#define LCD_E_Pin GPIO_PIN_10
+// NOTE: LCD pins are set in lcd_bus_t and lcd_t objects (see lcd.c)
 
 //#define LCD_GO_TO_NEW_LINE_IF_STRING_TOO_LONG	// uncomment if strings larger than screen size should break and continue on new line.
 #define LCD_WINDOW_PRINT_DELAY_MS 800 // delay between static view and window scrolling (used in LCD_PrintStringWindow();)
+#define LCD_MAX_MARQUEES 4 // maximum number of non-blocking scrolling regions started at the same time
+
+//#define LCD_USE_FRAMEBUFFER // uncomment to print into RAM framebuffer and update only changed characters with lcd_refresh()
+#define LCD_MAX_ROWS 4  // framebuffer size: maximum number of LCD rows
+#define LCD_MAX_COLS 20 // framebuffer size: maximum number of LCD columns
+
+//#define LCD_USE_GLYPH_CACHE // uncomment to upload registered custom characters to CGRAM on demand
+#define LCD_MAX_GLYPHS 16 // number of custom characters that can be registered (IDs 1 - LCD_MAX_GLYPHS)
+
+//#define LCD_ASYNC // uncomment to queue LCD transfers and send them with lcd_task() instead of blocking delays
+#define LCD_ASYNC_QUEUE_SIZE 256 // number of queued transfers (characters, commands, delays)
+
+//#define LCD_USE_PCF8574 // uncomment if LCD is connected via I2C PCF8574 backpack (LCD bus and E pin are not used)
+#define LCD_PCF8574_ADDRESS 0x27     // default 7-bit I2C address of PCF8574 (0x3F for PCF8574A), if not set in lcd_t
+#define LCD_PCF8574_BUFFER_SIZE (4 * (LCD_MAX_COLS + 1)) // I2C transaction: 4 bytes per character, row + cursor command
+
+//#define LCD_USE_BUSY_FLAG // uncomment to poll LCD busy flag (R/W pin) instead of fixed worst-case delays
 
 void lcd_delay_us(uint32_t uSec);
 void lcd_delay_ms(uint32_t mSec);
+uint32_t lcd_get_us(void);
+uint32_t lcd_get_ms(void);
 
 void lcd_init_pins(void);
 void lcd_write_pin(LCD_GPIO_PORT_TYPE *port, LCD_GPIO_PIN_TYPE pin, bool state);
+void lcd_write_data_pins(LCD_GPIO_PORT_TYPE *port, uint8_t value);
+bool lcd_read_pin(LCD_GPIO_PORT_TYPE *port, LCD_GPIO_PIN_TYPE pin);
+void lcd_set_pin_input(LCD_GPIO_PORT_TYPE *port, LCD_GPIO_PIN_TYPE pin, bool input);
+void lcd_i2c_write(uint8_t address, const uint8_t *data, uint16_t len);
 
 #endif /* __LCD_H */
@@ -19,3 +19,17 @@ void send_data(uint8_t *data, uint16_t size)
 {
 	//TODO: implement hardware specific UART handling.
 }
+
+/**
+ * @brief Start non-blocking transfer of data over UART peripheral (DMA or interrupt), used only with UART_PRINT_DMA.
+ *        When transfer is finished, printTxComplete() must be called (for example, from DMA transfer complete interrupt).
+ * @param pointer to a data, valid until printTxComplete() is called
+ * @param size of data (number of bytes to send)
+ * @retval None
+ */
+void send_data_start(uint8_t *data, uint16_t size)
+{
+	//TODO: implement hardware specific UART DMA/interrupt transfer, for example:
+	// HAL_UART_Transmit_DMA(&huart1, data, size);
+	// and call printTxComplete() in HAL_UART_TxCpltCallback()
+}
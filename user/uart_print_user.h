@@ -13,6 +13,11 @@
 /* Includes ------------------------------------------------------------------*/
 #include "stdint.h"
 
+//#define UART_PRINT_BUFFERED // uncomment to collect printed data in buffer and send it on new line, full buffer or printFlush()
+#define UART_PRINT_BUFFER_SIZE 128 // output buffer size in bytes (UART_PRINT_BUFFERED)
+//#define UART_PRINT_DMA // uncomment to drain buffer with non-blocking send_data_start() instead of send_data() (UART_PRINT_BUFFERED)
+
 void send_data(uint8_t *data, uint16_t size);
+void send_data_start(uint8_t *data, uint16_t size);
 
 #endif